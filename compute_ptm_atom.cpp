@@ -38,6 +38,7 @@ under
 #include "ptm_functions.h"
 
 #define NUM_COLUMNS 7
+#define NUM_INDEX_COLUMNS (PTM_MAX_INPUT_POINTS - 1)
 #define PTM_LAMMPS_UNKNOWN -1
 #define PTM_LAMMPS_OTHER 0
 
@@ -58,11 +59,20 @@ static const char cite_user_ptm_package[] =
     " DOI = {10.1088/0965-0393/24/5/055007}"
     "}\n\n";
 
-/* ---------------------------------------------------------------------- */
+/* ----------------------------------------------------------------------
+   compute ID group ptm/atom structures threshold keyword ...
+   keywords add columns: alloy, lattice, F, strain, template, indices
+     (F is the deformation gradient and strain is P - I, where P is the left
+     stretch tensor of F = P U, both row-major)
+   keyword displace d: only re-index atoms near a displacement larger than d;
+     a cached result may be for neighbour positions up to 2d from the current ones
+------------------------------------------------------------------------- */
 
 ComputePTMAtom::ComputePTMAtom(LAMMPS *lmp, int narg, char **arg)
-    : Compute(lmp, narg, arg), list(NULL), output(NULL) {
-  if (narg != 5)
+    : Compute(lmp, narg, arg), list(NULL), output(NULL), nhandles(0),
+      local_handles(NULL), displace_sq(0), xref(NULL), moved(NULL),
+      dirty(NULL), incremental(false), ref_step(-1), ref_nall(0) {
+  if (narg < 5)
     error->all(FLERR, "Illegal compute ptm/atom command");
 
   char *structures = arg[3];
@@ -120,15 +130,68 @@ ComputePTMAtom::ComputePTMAtom(LAMMPS *lmp, int narg, char **arg)
   if (rmsd_threshold == 0)
     rmsd_threshold = INFINITY;
 
+  // optional columns, appended after the standard ones in the order given
+  int ncols = NUM_COLUMNS;
+  col_alloy = col_lattice = col_F = col_strain = col_template = col_indices = -1;
+  for (int iarg = 5; iarg < narg; iarg++) {
+    int *col = NULL;
+    int width = 0;
+    if (strcmp(arg[iarg], "alloy") == 0) {
+      col = &col_alloy;
+      width = 1;
+    } else if (strcmp(arg[iarg], "lattice") == 0) {
+      col = &col_lattice;
+      width = 1;
+    } else if (strcmp(arg[iarg], "F") == 0) {
+      col = &col_F;
+      width = 9;
+    } else if (strcmp(arg[iarg], "strain") == 0) {
+      col = &col_strain;
+      width = 9;
+    } else if (strcmp(arg[iarg], "template") == 0) {
+      col = &col_template;
+      width = 1;
+    } else if (strcmp(arg[iarg], "indices") == 0) {
+      col = &col_indices;
+      width = NUM_INDEX_COLUMNS;
+    } else if (strcmp(arg[iarg], "displace") == 0) {
+      if (iarg + 1 >= narg)
+        error->all(FLERR, "Illegal compute ptm/atom command");
+      if (displace_sq > 0)
+        error->all(FLERR, "Illegal compute ptm/atom command (repeated keyword)");
+      double displace = force->numeric(FLERR, arg[++iarg]);
+      if (displace <= 0.0)
+        error->all(FLERR,
+                   "Illegal compute ptm/atom command (displacement is not positive)");
+      displace_sq = displace * displace;
+      continue;
+    } else
+      error->all(FLERR, "Illegal compute ptm/atom command (invalid keyword)");
+
+    if (*col >= 0)
+      error->all(FLERR, "Illegal compute ptm/atom command (repeated keyword)");
+    *col = ncols;
+    ncols += width;
+  }
+
   peratom_flag = 1;
-  size_peratom_cols = NUM_COLUMNS;
+  size_peratom_cols = ncols;
   create_attribute = 1;
   nmax = 0;
 }
 
 /* ---------------------------------------------------------------------- */
 
-ComputePTMAtom::~ComputePTMAtom() { memory->destroy(output); }
+ComputePTMAtom::~ComputePTMAtom() {
+  memory->destroy(output);
+  memory->destroy(xref);
+  memory->destroy(moved);
+  memory->destroy(dirty);
+  for (int i = 0; i < nhandles; i++)
+    if (local_handles[i] != NULL)
+      ptm_uninitialize_local(local_handles[i]);
+  delete[] local_handles;
+}
 
 /* ---------------------------------------------------------------------- */
 
@@ -159,6 +222,12 @@ void ComputePTMAtom::init_list(int /* id */, NeighList *ptr) { list = ptr; }
 
 /* ---------------------------------------------------------------------- */
 
+typedef struct {
+  int index;
+  double d;
+  double delta[3];
+} ptmnbr_t;
+
 typedef struct
 {
   double **x;
@@ -166,20 +235,15 @@ typedef struct
   int **firstneigh;
   int *ilist;
   int nlocal;
+  std::vector<ptmnbr_t> *nbr_order;     // scratch space, one per thread
 
 } ptmnbrdata_t;
 
-
-typedef struct {
-  int index;
-  double d;
-} ptmnbr_t;
-
 static bool sorthelper_compare(ptmnbr_t const &a, ptmnbr_t const &b) {
   return a.d < b.d;
 }
 
-static int get_neighbours(void* vdata, size_t central_index, size_t atom_index, int num, size_t* nbr_indices, int32_t* numbers, double (*nbr_pos)[3])
+static int get_neighbours(void* vdata, size_t central_index, size_t atom_index, int num, int* ordering, size_t* nbr_indices, int32_t* numbers, double (*nbr_pos)[3])
 {
   ptmnbrdata_t* data = (ptmnbrdata_t*)vdata;
 
@@ -197,7 +261,8 @@ static int get_neighbours(void* vdata, size_t central_index, size_t atom_index,
     jnum = data->numneigh[central_index];
   }
 
-  std::vector<ptmnbr_t> nbr_order;
+  std::vector<ptmnbr_t> &nbr_order = *data->nbr_order;
+  nbr_order.clear();
 
   for (int jj = 0; jj < jnum; jj++) {
     int j = jlist[jj];
@@ -205,28 +270,32 @@ static int get_neighbours(void* vdata, size_t central_index, size_t atom_index,
     if (j == atom_index)
       continue;
 
-    double dx = pos[0] - x[j][0];
-    double dy = pos[1] - x[j][1];
-    double dz = pos[2] - x[j][2];
+    double dx = x[j][0] - pos[0];
+    double dy = x[j][1] - pos[1];
+    double dz = x[j][2] - pos[2];
     double rsq = dx * dx + dy * dy + dz * dz;
 
-    ptmnbr_t nbr = {j, rsq};
+    ptmnbr_t nbr = {j, rsq, {dx, dy, dz}};
     nbr_order.push_back(nbr);
   }
 
-  std::sort(nbr_order.begin(), nbr_order.end(), &sorthelper_compare);
+  // only the nearest num - 1 are used, so the rest of the list is left unsorted
   int num_nbrs = std::min(num - 1, (int)nbr_order.size());
+  std::nth_element(nbr_order.begin(), nbr_order.begin() + num_nbrs, nbr_order.end(), &sorthelper_compare);
+  std::sort(nbr_order.begin(), nbr_order.begin() + num_nbrs, &sorthelper_compare);
 
   nbr_pos[0][0] = nbr_pos[0][1] = nbr_pos[0][2] = 0;
+  ordering[0] = 0;
   nbr_indices[0] = atom_index;
   numbers[0] = 0;
   for (int jj = 0; jj < num_nbrs; jj++) {
 
     int j = nbr_order[jj].index;
-    nbr_pos[jj + 1][0] = x[j][0] - pos[0];
-    nbr_pos[jj + 1][1] = x[j][1] - pos[1];
-    nbr_pos[jj + 1][2] = x[j][2] - pos[2];
+    nbr_pos[jj + 1][0] = nbr_order[jj].delta[0];
+    nbr_pos[jj + 1][1] = nbr_order[jj].delta[1];
+    nbr_pos[jj + 1][2] = nbr_order[jj].delta[2];
 
+    ordering[jj + 1] = jj + 1;
     nbr_indices[jj + 1] = j;
     numbers[jj + 1] = 0;
   }
@@ -235,39 +304,166 @@ static int get_neighbours(void* vdata, size_t central_index, size_t atom_index,
 }
 
 void ComputePTMAtom::compute_peratom() {
+  if (!setup_peratom())
+    return;
+
+  reserve_local_handles(1);
+  compute_range(local_handle(0), 0, list->inum);
+}
+
+/* ----------------------------------------------------------------------
+   work shared by the serial and threaded styles, done once per invocation;
+   returns false if the output of this timestep has already been computed
+------------------------------------------------------------------------- */
+
+bool ComputePTMAtom::setup_peratom() {
+  if (invoked_peratom == update->ntimestep && atom->nmax <= nmax)
+    return false;
+
   // PTM global initialization.  If already initialized this function does
   // nothing.
   ptm_initialize_global();
 
-  // initialize PTM local storage
-  ptm_local_handle_t local_handle = ptm_initialize_local();
-
   invoked_peratom = update->ntimestep;
 
-  // grow arrays if necessary
+  // grow arrays if necessary; cached results are lost
   if (atom->nmax > nmax) {
     memory->destroy(output);
     nmax = atom->nmax;
 
-    memory->create(output, nmax, NUM_COLUMNS, "ptm:ptm_output");
+    memory->create(output, nmax, size_peratom_cols, "ptm:ptm_output");
     array_atom = output;
+
+    if (displace_sq > 0) {
+      memory->destroy(xref);
+      memory->destroy(moved);
+      memory->destroy(dirty);
+      memory->create(xref, nmax, 3, "ptm:xref");
+      memory->create(moved, nmax, "ptm:moved");
+      memory->create(dirty, nmax, "ptm:dirty");
+    }
+    ref_step = -1;
   }
 
   // invoke full neighbor list (will copy or build if necessary)
   neighbor->build_one(list);
 
-  int inum = list->inum;
+  if (displace_sq > 0)
+    mark_dirty();
+  return true;
+}
+
+/* ----------------------------------------------------------------------
+   decide which atoms need to be re-indexed.  Local atom indices, ghost
+   atoms and neighbor lists only change on reneighboring, so the cached
+   output is reused only if no reneighboring has happened since the
+   reference positions were stored.  An atom is dirty if it or any atom in
+   its neighbor list has moved further than the threshold from its reference
+   position.  Only atoms which moved get a new reference position, so each
+   neighbour of a clean atom stays within the threshold of its reference
+   position.  The atom may have been indexed when that neighbour was already
+   up to the threshold away from it, though, so the neighbours of a clean atom
+   stay within twice the threshold of where they were when it was last
+   indexed.  Resetting the references of the neighbours on re-indexing would
+   not help, since the same atoms are neighbours of clean atoms too.
+------------------------------------------------------------------------- */
+
+void ComputePTMAtom::mark_dirty() {
+  double **x = atom->x;
+  int nall = atom->nlocal + atom->nghost;
+
+  incremental = ref_step >= 0 && ref_nall == nall &&
+                neighbor->lastcall <= ref_step &&
+                update->ntimestep >= ref_step;
+  if (!incremental) {
+    for (int i = 0; i < nall; i++) {
+      xref[i][0] = x[i][0];
+      xref[i][1] = x[i][1];
+      xref[i][2] = x[i][2];
+    }
+    ref_step = update->ntimestep;
+    ref_nall = nall;
+    return;
+  }
+
+  for (int i = 0; i < nall; i++) {
+    double dx = x[i][0] - xref[i][0];
+    double dy = x[i][1] - xref[i][1];
+    double dz = x[i][2] - xref[i][2];
+    moved[i] = dx * dx + dy * dy + dz * dz > displace_sq;
+  }
+
+  int *ilist = list->ilist;
+  int *numneigh = list->numneigh;
+  int **firstneigh = list->firstneigh;
+  for (int ii = 0; ii < list->inum; ii++) {
+    int i = ilist[ii];
+    int *jlist = firstneigh[i];
+    int jnum = numneigh[i];
+
+    dirty[i] = moved[i];
+    for (int jj = 0; jj < jnum && !dirty[i]; jj++)
+      dirty[i] = moved[jlist[jj] & NEIGHMASK];
+  }
+
+  for (int i = 0; i < nall; i++) {
+    if (moved[i]) {
+      xref[i][0] = x[i][0];
+      xref[i][1] = x[i][1];
+      xref[i][2] = x[i][2];
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   make room for n local handles; must be called outside parallel regions
+------------------------------------------------------------------------- */
+
+void ComputePTMAtom::reserve_local_handles(int n) {
+  if (n <= nhandles)
+    return;
+
+  ptm_local_handle_t *handles = new ptm_local_handle_t[n];
+  for (int i = 0; i < n; i++)
+    handles[i] = i < nhandles ? local_handles[i] : NULL;
+
+  delete[] local_handles;
+  local_handles = handles;
+  nhandles = n;
+}
+
+/* ----------------------------------------------------------------------
+   local handle of thread tid, created on first use; the voro++ scratch
+   space it holds is then reused by every later invocation
+------------------------------------------------------------------------- */
+
+ptm_local_handle_t ComputePTMAtom::local_handle(int tid) {
+  if (local_handles[tid] == NULL)
+    local_handles[tid] = ptm_initialize_local();
+  return local_handles[tid];
+}
+
+/* ----------------------------------------------------------------------
+   index the atoms ilist[ifrom..ito-1]; each thread calls this with its
+   own local handle
+------------------------------------------------------------------------- */
+
+void ComputePTMAtom::compute_range(ptm_local_handle_t local_handle, int ifrom, int ito) {
   int *ilist = list->ilist;
   int *numneigh = list->numneigh;
   int **firstneigh = list->firstneigh;
 
   double **x = atom->x;
   int *mask = atom->mask;
-  ptmnbrdata_t nbrlist = {x, numneigh, firstneigh, ilist, atom->nlocal};
+  std::vector<ptmnbr_t> nbr_order;
+  ptmnbrdata_t nbrlist = {x, numneigh, firstneigh, ilist, atom->nlocal, &nbr_order};
 
-  for (int ii = 0; ii < inum; ii++) {
+  for (int ii = ifrom; ii < ito; ii++) {
 
     int i = ilist[ii];
+    if (incremental && !dirty[i])
+      continue;
+
     output[i][0] = PTM_LAMMPS_UNKNOWN;
     if (!(mask[i] & groupbit))
       continue;
@@ -277,38 +473,61 @@ void ComputePTMAtom::compute_peratom() {
       continue;
 
 
-    // now run PTM
-    int32_t type, alloy_type;
-    double scale, rmsd, interatomic_distance;
-    double q[4];
+    // now run PTM; optional outputs which are not requested are skipped
+    int32_t type, alloy_type = PTM_ALLOY_NONE;
+    double scale, rmsd, interatomic_distance, lattice_constant = 0;
+    double q[4], F[9], F_res[3], U[9], P[9];
+    int template_index = 0;
+    int8_t indices[PTM_MAX_INPUT_POINTS];
+    bool need_F = col_F >= 0 || col_strain >= 0;
     bool standard_orientations = false;
     ptm_index(local_handle, i, get_neighbours, (void*)&nbrlist,
-              input_flags, standard_orientations,
+              input_flags, standard_orientations, rmsd_threshold,
               &type, &alloy_type, &scale, &rmsd, q,
-              NULL, NULL, NULL, NULL, &interatomic_distance, NULL, NULL);
-
-    if (rmsd > rmsd_threshold) {
-      type = PTM_MATCH_NONE;
-    }
-
-    // printf("%d type=%d rmsd=%f\n", i, type, rmsd);
-
+              need_F ? F : NULL, need_F ? F_res : NULL,
+              col_strain >= 0 ? U : NULL, col_strain >= 0 ? P : NULL,
+              &interatomic_distance,
+              col_lattice >= 0 ? &lattice_constant : NULL,
+              col_template >= 0 ? &template_index : NULL, NULL,
+              col_indices >= 0 ? indices : NULL);
+
+    double *row = output[i];
     if (type == PTM_MATCH_NONE) {
       type = PTM_LAMMPS_OTHER;
       rmsd = INFINITY;
+      for (int k = NUM_COLUMNS; k < size_peratom_cols; k++)
+        row[k] = 0;
+      if (col_indices >= 0)
+        for (int k = 0; k < NUM_INDEX_COLUMNS; k++)
+          row[col_indices + k] = -1;
+    } else {
+      if (col_alloy >= 0)
+        row[col_alloy] = alloy_type;
+      if (col_lattice >= 0)
+        row[col_lattice] = lattice_constant;
+      if (col_F >= 0)
+        for (int k = 0; k < 9; k++)
+          row[col_F + k] = F[k];
+      if (col_strain >= 0)
+        for (int k = 0; k < 9; k++)
+          row[col_strain + k] = P[k] - (k % 4 == 0 ? 1 : 0);
+      if (col_template >= 0)
+        row[col_template] = template_index;
+
+      // rank of the template's neighbours in order of distance, 1 = nearest
+      if (col_indices >= 0)
+        for (int k = 0; k < NUM_INDEX_COLUMNS; k++)
+          row[col_indices + k] = indices[k + 1];
     }
 
-    output[i][0] = type;
-    output[i][1] = rmsd;
-    output[i][2] = interatomic_distance;
-    output[i][3] = q[0];
-    output[i][4] = q[1];
-    output[i][5] = q[2];
-    output[i][6] = q[3];
+    row[0] = type;
+    row[1] = rmsd;
+    row[2] = interatomic_distance;
+    row[3] = q[0];
+    row[4] = q[1];
+    row[5] = q[2];
+    row[6] = q[3];
   }
-
-  // printf("finished ptm analysis\n");
-  ptm_uninitialize_local(local_handle);
 }
 
 /* ----------------------------------------------------------------------
@@ -316,7 +535,9 @@ void ComputePTMAtom::compute_peratom() {
 ------------------------------------------------------------------------- */
 
 double ComputePTMAtom::memory_usage() {
-  double bytes = nmax * NUM_COLUMNS * sizeof(double);
+  double bytes = nmax * size_peratom_cols * sizeof(double);
   bytes += nmax * sizeof(double);
+  if (displace_sq > 0)
+    bytes += nmax * (3 * sizeof(double) + 2 * sizeof(int));
   return bytes;
 }
@@ -22,23 +22,49 @@ ComputeStyle(ptm/atom,ComputePTMAtom)
 
 #include "compute.h"
 
+struct ptm_local_handle;
+
 namespace LAMMPS_NS {
 
 class ComputePTMAtom : public Compute {
  public:
   ComputePTMAtom(class LAMMPS *, int, char **);
-  ~ComputePTMAtom();
+  virtual ~ComputePTMAtom();
   void init();
   void init_list(int, class NeighList *);
-  void compute_peratom();
+  virtual void compute_peratom();
   double memory_usage();
 
- private:
+ protected:
   int nmax;
   int32_t input_flags;
   double rmsd_threshold;
   class NeighList *list;
   double **output;
+
+  // first column of each optional output, or -1 if not requested
+  int col_alloy, col_lattice, col_F, col_strain, col_template, col_indices;
+
+  // PTM local handles, one per thread, kept for the lifetime of the compute
+  int nhandles;
+  ::ptm_local_handle **local_handles;
+
+  // displacement-gated evaluation: atoms are only re-indexed if they or one
+  // of their neighbours moved more than sqrt(displace_sq) from its reference
+  // position; a cached result may be for neighbour positions up to twice that
+  // distance from the current ones
+  double displace_sq;
+  double **xref;
+  int *moved, *dirty;
+  bool incremental;
+  bigint ref_step;
+  int ref_nall;
+
+  bool setup_peratom();
+  void mark_dirty();
+  void reserve_local_handles(int);
+  ::ptm_local_handle *local_handle(int);
+  void compute_range(::ptm_local_handle *, int, int);
 };
 
 }
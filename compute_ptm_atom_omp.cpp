@@ -0,0 +1,71 @@
+/* ----------------------------------------------------------------------
+         LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+         http://lammps.sandia.gov, Sandia National Laboratories
+         Steve Plimpton, sjplimp@sandia.gov
+
+         Copyright (2003) Sandia Corporation.  Under the terms of Contract
+         DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+         certain rights in this software.  This software is distributed
+under
+         the GNU General Public License.
+
+         See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+/* ----------------------------------------------------------------------
+         Contributing author: PM Larsen (MIT)
+------------------------------------------------------------------------- */
+
+#include <algorithm>
+
+#include "compute_ptm_atom_omp.h"
+#include "neigh_list.h"
+
+#include "ptm_functions.h"
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+ComputePTMAtomOMP::ComputePTMAtomOMP(LAMMPS *lmp, int narg, char **arg)
+    : ComputePTMAtom(lmp, narg, arg) {}
+
+/* ---------------------------------------------------------------------- */
+
+void ComputePTMAtomOMP::compute_peratom() {
+  // the global tables are built here, before any thread needs them
+  if (!setup_peratom())
+    return;
+
+  const int inum = list->inum;
+#if defined(_OPENMP)
+  reserve_local_handles(omp_get_max_threads());
+#else
+  reserve_local_handles(1);
+#endif
+
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+  {
+#if defined(_OPENMP)
+    const int tid = omp_get_thread_num();
+    const int nthreads = omp_get_num_threads();
+#else
+    const int tid = 0;
+    const int nthreads = 1;
+#endif
+
+    // each thread takes one contiguous block of atoms, so rows of the
+    // output array are only shared between threads at block boundaries
+    const int idelta = 1 + inum / nthreads;
+    const int ifrom = std::min(tid * idelta, inum);
+    const int ito = std::min(ifrom + idelta, inum);
+
+    compute_range(local_handle(tid), ifrom, ito);
+  }
+}
@@ -0,0 +1,36 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef COMPUTE_CLASS
+
+ComputeStyle(ptm/atom/omp,ComputePTMAtomOMP)
+
+#else
+
+#ifndef LMP_COMPUTE_PTM_ATOM_OMP_H
+#define LMP_COMPUTE_PTM_ATOM_OMP_H
+
+#include "compute_ptm_atom.h"
+
+namespace LAMMPS_NS {
+
+class ComputePTMAtomOMP : public ComputePTMAtom {
+ public:
+  ComputePTMAtomOMP(class LAMMPS *, int, char **);
+  virtual void compute_peratom();
+};
+
+}
+
+#endif
+#endif
@@ -0,0 +1,216 @@
+/*Copyright (c) 2016 PM Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+//Generates ptm_graph_data.cpp and ptm_graph_index.h from the graphs written by graph_gen.py
+//(dumped_data.txt): the facets are made clockwise, and the canonical labellings and hashes are
+//computed with the same code that is used for matching.  Run "make graphdata" from the top level
+//directory after changing the graphs or the canonical form.
+//
+//usage: generate_graph_data <ptm_graph_data.cpp> <ptm_graph_index.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <vector>
+#include "ptm_canonical_coloured.h"
+#include "ptm_convex_hull_incremental.h"
+#include "ptm_graph_data.h"
+#include "ptm_graph_tools.h"
+
+
+using ptm::graph_t;
+
+namespace raw {
+#include "dumped_data.txt"
+}
+
+typedef struct
+{
+	const char* name;
+	int type;
+	int num_nbrs;
+	int num_facets;
+	int num_graphs;
+	graph_t* graphs;
+	const double (*points)[3];
+	bool diamond;
+} structure_t;
+
+//in the order of the hash index, which resolves ties as a per-structure search would
+static structure_t structures[] = {
+	{"sc",   PTM_MATCH_SC,   6,  8,  NUM_SC_GRAPHS,   raw::graphs_sc,   ptm_template_sc,   false},
+	{"fcc",  PTM_MATCH_FCC,  12, 20, NUM_FCC_GRAPHS,  raw::graphs_fcc,  ptm_template_fcc,  false},
+	{"hcp",  PTM_MATCH_HCP,  12, 20, NUM_HCP_GRAPHS,  raw::graphs_hcp,  ptm_template_hcp,  false},
+	{"ico",  PTM_MATCH_ICO,  12, 20, NUM_ICO_GRAPHS,  raw::graphs_ico,  ptm_template_ico,  false},
+	{"bcc",  PTM_MATCH_BCC,  14, 24, NUM_BCC_GRAPHS,  raw::graphs_bcc,  ptm_template_bcc,  false},
+	{"dcub", PTM_MATCH_DCUB, 16, 28, NUM_DCUB_GRAPHS, raw::graphs_dcub, ptm_template_dcub, true},
+	{"dhex", PTM_MATCH_DHEX, 16, 28, NUM_DHEX_GRAPHS, raw::graphs_dhex, ptm_template_dhex, true},
+};
+
+//the order in which graph_gen.py writes the structures
+static const char* file_order[] = {"sc", "ico", "fcc", "hcp", "bcc", "dcub", "dhex"};
+
+#define NUM_STRUCTURES ((int)(sizeof(structures) / sizeof(structure_t)))
+
+typedef struct
+{
+	uint64_t hash;
+	int structure;
+	int index;
+} entry_t;
+
+static bool entry_compare(entry_t const& a, entry_t const& b)
+{
+	return a.hash < b.hash;
+}
+
+static int complete_graphs(structure_t* s)
+{
+	int8_t colours[PTM_MAX_POINTS] = {0};
+	int8_t dcolours[PTM_MAX_POINTS] = {1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+
+	for (int i=0;i<s->num_graphs;i++)
+	{
+		graph_t* g = &s->graphs[i];
+
+		double plane_normal[3], origin[3] = {0, 0, 0};
+		for (int j=0;j<s->num_facets;j++)
+			ptm::add_facet(&s->points[1], g->facets[j][0], g->facets[j][1], g->facets[j][2], g->facets[j], plane_normal, origin);
+
+		int8_t degree[PTM_MAX_NBRS];
+		int8_t code[2 * PTM_MAX_EDGES];
+		ptm::graph_degree(s->num_facets, g->facets, s->num_nbrs, degree);
+		int ret = ptm::canonical_form_coloured(s->num_facets, g->facets, s->num_nbrs, degree, s->diamond ? dcolours : colours,
+							g->canonical_labelling, code, &g->hash);
+		if (ret != PTM_NO_ERROR)
+			return ret;
+	}
+
+	return PTM_NO_ERROR;
+}
+
+static const char* license =
+"/*Copyright (c) 2016 PM Larsen\n"
+"\n"
+"Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the \"Software\"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:\n"
+"\n"
+"The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.\n"
+"\n"
+"THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.\n"
+"*/\n";
+
+static void write_graph_data(FILE* f)
+{
+	fprintf(f, "%s\n", license);
+	fprintf(f, "//generated by datagen/generate_graph_data from datagen/dumped_data.txt, do not edit\n\n");
+	fprintf(f, "#include \"ptm_graph_data.h\"\n\n\n");
+	fprintf(f, "namespace ptm {\n\n");
+
+	int num_automorphisms = sizeof(raw::automorphisms) / sizeof(raw::automorphisms[0]);
+	int width = sizeof(raw::automorphisms[0]);
+	fprintf(f, "const int8_t automorphisms[%d][%d] = {\n", num_automorphisms, width);
+	for (int i=0;i<num_automorphisms;i++)
+	{
+		fprintf(f, "        {");
+		for (int j=0;j<width;j++)
+			fprintf(f, "%3d%s", raw::automorphisms[i][j], j == width - 1 ? "},\n" : ",");
+	}
+	fprintf(f, "};\n\n");
+
+	for (int k=0;k<NUM_STRUCTURES;k++)
+	{
+		structure_t* s = NULL;
+		for (int i=0;i<NUM_STRUCTURES;i++)
+			if (strcmp(structures[i].name, file_order[k]) == 0)
+				s = &structures[i];
+
+		char upper[8] = {0};
+		for (int i=0;s->name[i];i++)
+			upper[i] = s->name[i] - 'a' + 'A';
+
+		fprintf(f, "const graph_t graphs_%s[NUM_%s_GRAPHS] = {\n\n", s->name, upper);
+		for (int i=0;i<s->num_graphs;i++)
+		{
+			graph_t* g = &s->graphs[i];
+			fprintf(f, "{%d,\nUINT64_C(0x%016llx),\n%d,\n%d,\n{", g->id, (unsigned long long)g->hash, g->automorphism_index, g->num_automorphisms);
+			for (int j=0;j<s->num_nbrs+1;j++)
+				fprintf(f, "%d%s", g->canonical_labelling[j], j == s->num_nbrs ? "},\n{" : ", ");
+			for (int j=0;j<s->num_facets;j++)
+				fprintf(f, "{%d,%d,%d}%s", g->facets[j][0], g->facets[j][1], g->facets[j][2], j == s->num_facets - 1 ? "}},\n\n" : ",");
+		}
+		fprintf(f, "};\n\n");
+	}
+
+	fprintf(f, "}\n\n");
+}
+
+static void write_graph_index(FILE* f)
+{
+	std::vector<entry_t> entries;
+	for (int k=0;k<NUM_STRUCTURES;k++)
+	{
+		for (int i=0;i<structures[k].num_graphs;i++)
+		{
+			entry_t e = {structures[k].graphs[i].hash, k, i};
+			entries.push_back(e);
+		}
+	}
+
+	std::stable_sort(entries.begin(), entries.end(), &entry_compare);
+
+	fprintf(f, "%s\n", license);
+	fprintf(f, "//generated by datagen/generate_graph_data from datagen/dumped_data.txt, do not edit\n\n");
+	fprintf(f, "#ifndef PTM_GRAPH_INDEX_H\n#define PTM_GRAPH_INDEX_H\n\n");
+	fprintf(f, "#include \"ptm_initialize_data.h\"\n\n");
+	fprintf(f, "namespace ptm {\n\n");
+	fprintf(f, "#define PTM_NUM_GRAPHS (NUM_SC_GRAPHS + NUM_FCC_GRAPHS + NUM_HCP_GRAPHS + NUM_ICO_GRAPHS + NUM_BCC_GRAPHS + NUM_DCUB_GRAPHS + NUM_DHEX_GRAPHS)\n\n");
+	fprintf(f, "//graphs of all structures sorted by canonical hash.  Entries with equal hashes are in the order\n");
+	fprintf(f, "//sc, fcc, hcp, ico, bcc, dcub, dhex, so that ties are resolved as in a per-structure search.\n");
+	fprintf(f, "static const graphentry_t graph_entries[PTM_NUM_GRAPHS] = {\n");
+	for (size_t i=0;i<entries.size();i++)
+	{
+		const char* name = structures[entries[i].structure].name;
+		fprintf(f, "        {UINT64_C(0x%016llx), &structure_%s, &graphs_%s[%d]},\n", (unsigned long long)entries[i].hash, name, name, entries[i].index);
+	}
+	fprintf(f, "};\n\n}\n\n#endif\n\n");
+}
+
+int main(int argc, char** argv)
+{
+	if (argc != 3)
+	{
+		fprintf(stderr, "usage: %s <ptm_graph_data.cpp> <ptm_graph_index.h>\n", argv[0]);
+		return 1;
+	}
+
+	for (int k=0;k<NUM_STRUCTURES;k++)
+	{
+		int ret = complete_graphs(&structures[k]);
+		if (ret != PTM_NO_ERROR)
+		{
+			fprintf(stderr, "canonical form of %s graph failed: %d\n", structures[k].name, ret);
+			return 1;
+		}
+	}
+
+	FILE* fdata = fopen(argv[1], "w");
+	FILE* findex = fopen(argv[2], "w");
+	if (fdata == NULL || findex == NULL)
+	{
+		fprintf(stderr, "could not open output files\n");
+		return 1;
+	}
+
+	write_graph_data(fdata);
+	write_graph_index(findex);
+	fclose(fdata);
+	fclose(findex);
+	return 0;
+}
@@ -4,174 +4,768 @@
 #include <cstdlib>
 #include <string.h>
 #include <cassert>
+#include <cmath>
+#include <chrono>
+#include <vector>
 #include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "ptm_functions.h"
 #include "unittest.hpp"
+#include "trajectory.hpp"
 
 using namespace std;
 
-//#define _MAX_NBRS 50	//diamond
-#define _MAX_NBRS 24	//fcc, other
-//#define _MAX_NBRS 6	//graphene
+/*
+	Benchmark of synthetic systems.  Each structure is generated as a perfect crystal, with
+	thermal noise, with vacancies, and as a bicrystal with two grain boundaries, and indexed
+	with several sets of structure flags.  Results are written to stdout as CSV, one row per run.
+	Build with -DPTM_ENABLE_STATS for the time spent in each stage and the rejection counts.
+
+	usage: benchmark [-n cells] [-r repeats] [-t threads] [-s]
+		-n	number of unit cells along each cell vector (default 8)
+		-r	number of timed repeats; the fastest is reported (default 3)
+		-t	number of threads (default 1)
+		-s	skip the unit tests
+
+	With -T the program indexes every frame of a LAMMPS text or binary dump or an extended XYZ
+	file, holding one frame at a time, and writes one CSV row of structure type counts per frame.
+
+	usage: benchmark -T trajectory [-o types] [-a] [-w guard] [-t threads]
+		-o	output file, written as one int32 structure type per atom for each frame in turn; the atoms
+			of LAMMPS dumps are in the order of their ids, so rows match across frames
+		-a	check all structure types (default: FCC, HCP, BCC and ICO)
+		-w	reuse the match of the previous frame for atoms whose neighbours are unchanged,
+			while its RMSD stays below guard (see ptm_warm_start_t)
+
+	With -p the program instead indexes a system read from binary files, which are memory
+	mapped and used in place, and writes the number of atoms of each structure type as CSV.
+
+	usage: benchmark -p positions [-f] [-b nbrs -m max_nbrs] [-l lx,ly,lz] [-o types] [-a] [-S] [-t threads]
+		-p	atomic positions, three doubles per atom
+		-f	the positions are three floats per atom; the library works in double precision, so
+			they are converted to a copy in memory of twice the size of the file instead of
+			being used in place
+		-b	neighbour table, max_nbrs int32 per atom sorted by distance and padded with -1;
+			if not given the neighbours are found with the cell-list search
+		-m	row length of the neighbour table
+		-l	lengths of a periodic orthorhombic cell; the system is not periodic if not given
+		-o	output file, written as one int32 structure type per atom
+		-a	check all structure types (default: FCC, HCP, BCC and ICO)
+		-S	advise the kernel that the positions are read sequentially, which suits systems
+			sorted in space; the neighbour table is always read sequentially
+*/
+
+//deterministic random numbers, so that the generated systems are identical on every platform
+typedef struct
+{
+	uint64_t state;
+} rng_t;
 
+static uint64_t rng_next(rng_t* rng)
+{
+	uint64_t z = (rng->state += 0x9e3779b97f4a7c15ULL);
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+	return z ^ (z >> 31);
+}
 
-static int read_file(const char* path, uint8_t** p_buf, size_t* p_fsize)
+static double rng_uniform(rng_t* rng)
 {
-	size_t fsize = 0, num_read = 0;
-	uint8_t* buf = NULL;
+	return (rng_next(rng) >> 11) * (1.0 / 9007199254740992.0);
+}
 
-	FILE* fin = fopen(path, "rb");
-	if (fin == NULL)
-		return -1;
+static double rng_normal(rng_t* rng)
+{
+	double u = std::max(rng_uniform(rng), 1E-300);
+	double v = rng_uniform(rng);
+	return sqrt(-2 * log(u)) * cos(2 * M_PI * v);
+}
 
-	int ret = fseek(fin, 0, SEEK_END);
-	if (ret != 0)
-		goto cleanup;
+typedef struct
+{
+	const char* name;
+	int32_t check;
+	int32_t type;
+	double cell[3];				//orthorhombic unit cell, in units of the nearest neighbour distance
+	bool periodic_z;
+	int num_basis;
+	const double (*basis)[3];		//fractional coordinates
+} latticedata_t;
+
+const double sc_basis[1][3] = {{0, 0, 0}};
+const double fcc_basis[4][3] = {{0, 0, 0}, {0, 0.5, 0.5}, {0.5, 0, 0.5}, {0.5, 0.5, 0}};
+const double bcc_basis[2][3] = {{0, 0, 0}, {0.5, 0.5, 0.5}};
+const double hcp_basis[4][3] = {{0, 0, 0}, {0.5, 0.5, 0}, {0, 1. / 3, 0.5}, {0.5, 5. / 6, 0.5}};
+const double dcub_basis[8][3] = {	{0, 0, 0}, {0, 0.5, 0.5}, {0.5, 0, 0.5}, {0.5, 0.5, 0},
+					{0.25, 0.25, 0.25}, {0.25, 0.75, 0.75}, {0.75, 0.25, 0.75}, {0.75, 0.75, 0.25}};
+const double dhex_basis[8][3] = {	{0, 0, 0}, {0.5, 0.5, 0}, {0, 1. / 3, 0.5}, {0.5, 5. / 6, 0.5},
+					{0, 0, 0.375}, {0.5, 0.5, 0.375}, {0, 1. / 3, 0.875}, {0.5, 5. / 6, 0.875}};
+const double graphene_basis[4][3] = {{0, 0, 0}, {1. / 3, 0, 0}, {0.5, 0.5, 0}, {5. / 6, 0.5, 0}};
+
+//icosahedral clusters on a sparse cubic grid; only the central atoms are icosahedral
+const double ico_cell = 4.0;
+const double ico_basis[13][3] = {	{0.5, 0.5, 0.5},
+					{0.5, 0.5 + 0.131433, 0.5 + 0.212663}, {0.5, 0.5 - 0.131433, 0.5 + 0.212663},
+					{0.5, 0.5 + 0.131433, 0.5 - 0.212663}, {0.5, 0.5 - 0.131433, 0.5 - 0.212663},
+					{0.5 + 0.131433, 0.5 + 0.212663, 0.5}, {0.5 - 0.131433, 0.5 + 0.212663, 0.5},
+					{0.5 + 0.131433, 0.5 - 0.212663, 0.5}, {0.5 - 0.131433, 0.5 - 0.212663, 0.5},
+					{0.5 + 0.212663, 0.5, 0.5 + 0.131433}, {0.5 - 0.212663, 0.5, 0.5 + 0.131433},
+					{0.5 + 0.212663, 0.5, 0.5 - 0.131433}, {0.5 - 0.212663, 0.5, 0.5 - 0.131433}};
+
+#define NUM_LATTICES 8
+const latticedata_t lattices[NUM_LATTICES] = {
+	{"sc",		PTM_CHECK_SC,		PTM_MATCH_SC,		{1, 1, 1},						true,	1, sc_basis},
+	{"fcc",		PTM_CHECK_FCC,		PTM_MATCH_FCC,		{M_SQRT2, M_SQRT2, M_SQRT2},				true,	4, fcc_basis},
+	{"hcp",		PTM_CHECK_HCP,		PTM_MATCH_HCP,		{1, sqrt(3), sqrt(8. / 3)},				true,	4, hcp_basis},
+	{"bcc",		PTM_CHECK_BCC,		PTM_MATCH_BCC,		{2 / sqrt(3), 2 / sqrt(3), 2 / sqrt(3)},		true,	2, bcc_basis},
+	{"ico",		PTM_CHECK_ICO,		PTM_MATCH_ICO,		{ico_cell, ico_cell, ico_cell},				true,	13, ico_basis},
+	{"dcub",	PTM_CHECK_DCUB,		PTM_MATCH_DCUB,		{4 / sqrt(3), 4 / sqrt(3), 4 / sqrt(3)},		true,	8, dcub_basis},
+	{"dhex",	PTM_CHECK_DHEX,		PTM_MATCH_DHEX,		{sqrt(8. / 3), sqrt(8), 8. / 3},			true,	8, dhex_basis},
+	{"graphene",	PTM_CHECK_GRAPHENE,	PTM_MATCH_GRAPHENE,	{3, sqrt(3), 10},					false,	4, graphene_basis},
+};
 
-	fsize = ftell(fin);
-	ret = fseek(fin, 0, SEEK_SET);
-	if (ret != 0)
-		goto cleanup;
+typedef struct
+{
+	const char* name;
+	double noise;			//standard deviation of the displacements, in units of the nearest neighbour distance
+	double vacancies;		//fraction of atoms removed
+	double misorientation;		//rotation of the two grains about the z-axis, in degrees
+} conditiondata_t;
+
+#define NUM_CONDITIONS 4
+const conditiondata_t conditions[NUM_CONDITIONS] = {
+	{"perfect",		0,	0,	0},
+	{"thermal",		0.05,	0,	0},
+	{"vacancies",		0.02,	0.05,	0},
+	{"grain_boundary",	0.02,	0,	18},
+};
+
+typedef struct
+{
+	std::vector<double> positions;
+	double cell[9];
+	bool pbc[3];
+} systembuffer_t;
+
+static size_t num_atoms(const systembuffer_t* b)
+{
+	return b->positions.size() / 3;
+}
+
+static void add_atom(systembuffer_t* b, const double* x)
+{
+	b->positions.insert(b->positions.end(), x, x + 3);
+}
 
-	buf = (uint8_t*)malloc(fsize);
-	if (buf == NULL)
+//removes atoms whose nearest neighbour is closer than min_dist, as happens at grain boundaries
+static void remove_overlaps(systembuffer_t* b, double min_dist)
+{
+	size_t n = num_atoms(b);
+	ptm_system_t system = {n, (const double (*)[3])b->positions.data(), NULL, b->cell, {b->pbc[0], b->pbc[1], b->pbc[2]}, 0, NULL};
+	std::vector<int32_t> nbrs(n);
+	if (ptm_build_neighbour_table(&system, 1, 1, nbrs.data()) != PTM_NO_ERROR)
+		return;
+
+	std::vector<double> kept;
+	for (size_t i=0;i<n;i++)
 	{
-		ret = -1;
-		goto cleanup;
+		int32_t j = nbrs[i];
+		if (j >= 0 && (size_t)j < i)
+		{
+			double d = 0;
+			for (int k=0;k<3;k++)
+			{
+				double delta = b->positions[j * 3 + k] - b->positions[i * 3 + k];
+				if (b->pbc[k])
+					delta -= b->cell[k * 3 + k] * round(delta / b->cell[k * 3 + k]);
+				d += delta * delta;
+			}
+
+			if (d < min_dist * min_dist)
+				continue;
+		}
+
+		kept.insert(kept.end(), &b->positions[i * 3], &b->positions[i * 3] + 3);
+	}
+
+	b->positions.swap(kept);
+}
+
+static void generate_system(const latticedata_t* lattice, const conditiondata_t* condition, int n, uint64_t seed, systembuffer_t* b)
+{
+	rng_t rng = {seed};
+	b->positions.clear();
+
+	double length[3];
+	for (int k=0;k<3;k++)
+		length[k] = lattice->cell[k] * (k == 2 && !lattice->periodic_z ? 1 : n);
+
+	memset(b->cell, 0, 9 * sizeof(double));
+	for (int k=0;k<3;k++)
+	{
+		b->cell[k * 3 + k] = length[k];
+		b->pbc[k] = k < 2 || lattice->periodic_z;
 	}
 
-	num_read = fread(buf, 1, fsize, fin);
-	if (num_read != fsize)
+	//each grain is a rotated lattice, cut to one half of the box along x
+	int num_grains = condition->misorientation != 0 ? 2 : 1;
+	for (int g=0;g<num_grains;g++)
 	{
-		ret = -1;
-		goto cleanup;
+		double angle = num_grains == 1 ? 0 : (g == 0 ? 0.5 : -0.5) * condition->misorientation * M_PI / 180;
+		double c = cos(angle), s = sin(angle);
+		int m = num_grains == 1 ? 0 : n;	//rotated grains need a larger supply of lattice points
+
+		for (int i=-m;i<n+m;i++)
+		for (int j=-m;j<n+m;j++)
+		for (int k=0;k<(lattice->periodic_z ? n : 1);k++)
+		for (int l=0;l<lattice->num_basis;l++)
+		{
+			double p[3] = {	(i + lattice->basis[l][0]) * lattice->cell[0],
+					(j + lattice->basis[l][1]) * lattice->cell[1],
+					(k + lattice->basis[l][2]) * lattice->cell[2]};
+
+			if (num_grains > 1)
+			{
+				double x = p[0] - length[0] / 2, y = p[1] - length[1] / 2;
+				p[0] = c * x - s * y + length[0] / 2;
+				p[1] = s * x + c * y + length[1] / 2;
+				if (p[0] < 0 || p[0] >= length[0] || p[1] < 0 || p[1] >= length[1])
+					continue;
+				if ((p[0] < length[0] / 2) != (g == 0))
+					continue;
+			}
+
+			add_atom(b, p);
+		}
 	}
 
-cleanup:
-	if (ret != 0)
+	if (num_grains > 1)
+		remove_overlaps(b, 0.6);
+
+	if (condition->vacancies > 0)
 	{
-		free(buf);
-		buf = NULL;
+		std::vector<double> kept;
+		for (size_t i=0;i<num_atoms(b);i++)
+			if (rng_uniform(&rng) >= condition->vacancies)
+				kept.insert(kept.end(), &b->positions[i * 3], &b->positions[i * 3] + 3);
+		b->positions.swap(kept);
 	}
 
-	*p_fsize = fsize;
-	*p_buf = buf;
-	fclose(fin);
-	return ret;
+	if (condition->noise > 0)
+		for (size_t i=0;i<b->positions.size();i++)
+			if (lattice->periodic_z || i % 3 != 2)
+				b->positions[i] += condition->noise * rng_normal(&rng);
 }
 
+static const char* flags_name(const latticedata_t* lattice, int32_t flags)
+{
+	if (flags == PTM_CHECK_DEFAULT)
+		return "default";
+	if (flags == PTM_CHECK_ALL)
+		return "all";
+	return lattice->name;
+}
+
+//adds the statistics of b to a
+static void add_stats(ptm_stats_t* a, const ptm_stats_t* b)
+{
+	a->num_atoms += b->num_atoms;
+	a->num_matched += b->num_matched;
+	a->num_reused += b->num_reused;
+	for (int i=0;i<PTM_NUM_STAGES;i++)
+	{
+		a->calls[i] += b->calls[i];
+		a->seconds[i] += b->seconds[i];
+	}
+
+	for (int i=0;i<PTM_NUM_REJECTIONS;i++)
+		a->rejected[i] += b->rejected[i];
+}
+
+static double elapsed(std::chrono::steady_clock::time_point t0)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+//writes the number of atoms of each structure type, as CSV columns
+static void print_type_counts(const int32_t* types, size_t num)
+{
+	size_t counts[PTM_MATCH_GRAPHENE + 1] = {0};
+	for (size_t i=0;i<num;i++)
+		counts[types[i]]++;
+
+	for (int i=0;i<=PTM_MATCH_GRAPHENE;i++)
+		printf(",%lu", (unsigned long)counts[i]);
+}
+
+//a memory mapped file
 typedef struct
 {
-	double (*positions)[3];
-	int32_t* nbrs;
+	void* data;
+	size_t size;
+} mappedfile_t;
+
+static int map_file(const char* path, bool sequential, mappedfile_t* m)
+{
+	m->data = NULL;
+	m->size = 0;
+
+	int fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return -1;
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size <= 0)
+	{
+		close(fd);
+		return -1;
+	}
 
-} demonbrdata_t;
+	//the mapping stays valid after the descriptor is closed
+	void* data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED)
+		return -1;
+
+	if (sequential)
+		madvise(data, st.st_size, MADV_SEQUENTIAL);
+
+	m->data = data;
+	m->size = st.st_size;
+	return 0;
+}
+
+//creates a file of the given size and maps it for writing, so that results go straight to the page cache
+static int create_mapped_file(const char* path, size_t size, mappedfile_t* m)
+{
+	m->data = NULL;
+	m->size = 0;
+
+	int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		return -1;
+
+	if (ftruncate(fd, size) != 0)
+	{
+		close(fd);
+		return -1;
+	}
+
+	void* data = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED)
+		return -1;
+
+	m->data = data;
+	m->size = size;
+	return 0;
+}
+
+static void unmap_file(mappedfile_t* m)
+{
+	if (m->data != NULL)
+		munmap(m->data, m->size);
+	m->data = NULL;
+	m->size = 0;
+}
 
-static int get_neighbours(void* vdata, size_t central_index, size_t atom_index, int num, int* ordering, size_t* nbr_indices, int32_t* numbers, double (*nbr_pos)[3])
+typedef struct
+{
+	const char* positions_path;
+	bool single_precision;
+	const char* nbrs_path;
+	int max_nbrs;
+	bool periodic;
+	double lengths[3];
+	const char* output_path;
+	int32_t flags;
+	bool sequential;
+	int num_threads;
+} fileoptions_t;
+
+static int index_files(const fileoptions_t* options)
 {
-	demonbrdata_t* data = (demonbrdata_t*)vdata;
-	double (*positions)[3] = data->positions;
-	int32_t* nbrs = data->nbrs;
+	mappedfile_t positions_file, nbrs_file, output_file;
+	memset(&nbrs_file, 0, sizeof(mappedfile_t));
+	memset(&output_file, 0, sizeof(mappedfile_t));
+
+	if (map_file(options->positions_path, options->sequential, &positions_file) != 0)
+	{
+		fprintf(stderr, "cannot map %s\n", options->positions_path);
+		return -1;
+	}
+
+	int ret = -1;
+	ptm_local_handle_t local_handle = NULL;
+	std::vector<double> converted;
+	std::vector<int32_t> types;
+	std::chrono::steady_clock::time_point t0;
+	double seconds = 0;
+
+	size_t element_size = options->single_precision ? sizeof(float) : sizeof(double);
+	size_t num = positions_file.size / (3 * element_size);
+	if (positions_file.size % (3 * element_size) != 0)
+	{
+		fprintf(stderr, "%s does not hold whole positions\n", options->positions_path);
+		goto cleanup;
+	}
+
+	ptm_system_t system;
+	memset(&system, 0, sizeof(ptm_system_t));
+	system.num_atoms = num;
+	system.positions = (const double (*)[3])positions_file.data;
+
+	//the library works in double precision, so single precision positions cannot be used in place
+	if (options->single_precision)
+	{
+		const float* x = (const float*)positions_file.data;
+		converted.assign(x, x + 3 * num);
+		unmap_file(&positions_file);
+		system.positions = (const double (*)[3])converted.data();
+	}
+
+	double cell[9];
+	if (options->periodic)
+	{
+		memset(cell, 0, 9 * sizeof(double));
+		for (int k=0;k<3;k++)
+			cell[k * 3 + k] = options->lengths[k];
+		system.cell = cell;
+		system.pbc[0] = system.pbc[1] = system.pbc[2] = true;
+	}
+
+	if (options->nbrs_path != NULL)
+	{
+		if (options->max_nbrs <= 0 || map_file(options->nbrs_path, true, &nbrs_file) != 0)
+		{
+			fprintf(stderr, "cannot map %s\n", options->nbrs_path);
+			goto cleanup;
+		}
 
-	memcpy(nbr_pos[0], positions[atom_index], 3 * sizeof(double));
-	nbr_indices[0] = atom_index;
-	if (numbers != NULL)
-		numbers[0] = 0;
+		if (nbrs_file.size != num * options->max_nbrs * sizeof(int32_t))
+		{
+			fprintf(stderr, "%s does not hold %d neighbours for each atom\n", options->nbrs_path, options->max_nbrs);
+			goto cleanup;
+		}
+
+		system.max_nbrs = options->max_nbrs;
+		system.nbrs = (const int32_t*)nbrs_file.data;
+	}
+
+	ptm_output_t output;
+	memset(&output, 0, sizeof(ptm_output_t));
+	output.mask = 0;		//structure types only
+	if (options->output_path != NULL)
+	{
+		if (create_mapped_file(options->output_path, std::max(num, (size_t)1) * sizeof(int32_t), &output_file) != 0)
+		{
+			fprintf(stderr, "cannot create %s\n", options->output_path);
+			goto cleanup;
+		}
+		output.type = (int32_t*)output_file.data;
+	}
+	else
+	{
+		types.resize(num);
+		output.type = types.data();
+	}
 
-	int n = std::min(num - 1, _MAX_NBRS);
-	for (int j=0;j<n;j++)
+	t0 = std::chrono::steady_clock::now();
+	if (options->num_threads == 1)
 	{
-		size_t index = nbrs[atom_index * _MAX_NBRS + j];
-		nbr_indices[j+1] = index;
-		if (numbers != NULL)
-			numbers[j+1] = 0;
+		local_handle = ptm_initialize_local();
+		ret = ptm_index_many(local_handle, &system, options->flags, false, INFINITY, NULL, &output);
+	}
+	else
+	{
+		ret = ptm_index_many_threaded(&system, options->flags, false, INFINITY, options->num_threads, NULL, &output, NULL);
+	}
+	seconds = elapsed(t0);
 
-		memcpy(nbr_pos[j+1], positions[index], 3 * sizeof(double));
+	if (ret != PTM_NO_ERROR)
+	{
+		fprintf(stderr, "indexing failed\n");
+		goto cleanup;
 	}
 
-	return n + 1;
+	printf("num_atoms,none,fcc,hcp,bcc,ico,sc,dcub,dhex,graphene,seconds\n");
+	printf("%lu", (unsigned long)num);
+	print_type_counts(output.type, num);
+	printf(",%.6f\n", seconds);
+
+cleanup:
+	if (local_handle != NULL)
+		ptm_uninitialize_local(local_handle);
+	unmap_file(&output_file);
+	unmap_file(&nbrs_file);
+	unmap_file(&positions_file);
+	return ret;
 }
 
-int main()
+//indexes the frames of a trajectory one at a time, so that memory use does not grow with its length
+static int index_trajectory(const char* path, int32_t flags, int num_threads, const char* output_path, double guard_rmsd)
 {
-	ptm_initialize_global();
-	uint64_t res = ptm::run_tests();
-	assert(res == 0);
-	//printf("=========================================================\n");
-	//printf("unit test result: %lu\n", res);
-	//return 0;
-
-	size_t fsize = 0;
-	int32_t* nbrs = NULL;
-	double (*positions)[3] = NULL;
-	int ret = read_file((char*)"test_data/FeCu_positions.dat", (uint8_t**)&positions, &fsize);
-	//int ret = read_file((char*)"test_data/fcc_positions.dat", (uint8_t**)&positions, &fsize);
-	//int ret = read_file((char*)"test_data/diamond_pos.dat", (uint8_t**)&positions, &fsize);
-	//int ret = read_file((char*)"test_data/graphene_pos.dat", (uint8_t**)&positions, &fsize);
-	if (ret != 0)
+	trajectory_t trajectory;
+	if (trajectory_open(path, &trajectory) != 0)
+	{
+		fprintf(stderr, "cannot open %s\n", path);
 		return -1;
+	}
 
-	ret = read_file((char*)"test_data/FeCu_nbrs.dat", (uint8_t**)&nbrs, &fsize);
-	//ret = read_file((char*)"test_data/fcc_nbrs.dat", (uint8_t**)&nbrs, &fsize);
-	//ret = read_file((char*)"test_data/diamond_nbrs.dat", (uint8_t**)&nbrs, &fsize);
-	//ret = read_file((char*)"test_data/graphene_nbrs.dat", (uint8_t**)&nbrs, &fsize);
-	if (ret != 0)
+	FILE* fout = NULL;
+	if (output_path != NULL && (fout = fopen(output_path, "wb")) == NULL)
+	{
+		fprintf(stderr, "cannot create %s\n", output_path);
+		trajectory_close(&trajectory);
 		return -1;
+	}
 
-	int num_atoms = fsize / (_MAX_NBRS * sizeof(int32_t));
-	demonbrdata_t nbrlist = {positions, nbrs};
+	const int max_nbrs = PTM_MAX_INPUT_POINTS - 1;
+	ptm_local_handle_t local_handle = ptm_initialize_local();
+	ptm_warm_start_t warm_start = guard_rmsd > 0 ? ptm_initialize_warm_start(guard_rmsd) : NULL;
+	frame_t frame;
+	std::vector<int32_t> nbrs, types;
 
-	//assert(num_atoms == 88737);
-	printf("num atoms: %d\n", num_atoms);
+	printf("frame,timestep,num_atoms,none,fcc,hcp,bcc,ico,sc,dcub,dhex,graphene,seconds_neighbours,seconds_index\n");
 
-	int8_t* types = (int8_t*)calloc(sizeof(int8_t), num_atoms);
-	double* rmsds = (double*)calloc(sizeof(double), num_atoms);
-	double* quats = (double*)calloc(4 * sizeof(double), num_atoms);
-	int counts[9] = {0};
+	int ret = PTM_NO_ERROR;
+	for (size_t f=0;;f++)
+	{
+		int status = trajectory_read_frame(&trajectory, &frame);
+		if (status == 0)
+			break;
 
-	ptm_local_handle_t local_handle = ptm_initialize_local();
+		if (status < 0)
+		{
+			fprintf(stderr, "malformed frame %lu in %s\n", (unsigned long)f, path);
+			ret = -1;
+			break;
+		}
 
-	double rmsd_sum = 0.0;
-	for (int i=0;i<num_atoms;i++)
-	{
-		int8_t output_indices[PTM_MAX_INPUT_POINTS];
-		int32_t type, alloy_type;
-		double scale, rmsd, interatomic_distance, lattice_constant;
-		double q[4], F[9], F_res[3], U[9], P[9];
-		ptm_index(	local_handle, i, get_neighbours, (void*)&nbrlist, PTM_CHECK_ALL, true,
-				&type, &alloy_type, &scale, &rmsd, q, F, F_res, U, P, &interatomic_distance, &lattice_constant, NULL, NULL, output_indices);
-//{
-//	printf("#scale %f\n", scale);
-//	printf("#quat %f %f %f %f\n", q[0], q[1], q[2], q[3]);
-//	for (int j=0;j<32;j++)
-//		printf("!!!%f %f %f\n", nbr_pos[j][0], nbr_pos[j][1], nbr_pos[j][2]);
-//}
-
-		types[i] = type;
-		rmsds[i] = rmsd;
-		memcpy(&quats[i*4], q, 4 * sizeof(double));
-
-		counts[type]++;
-		if (type != PTM_MATCH_NONE)
-			rmsd_sum += rmsd;
-
-		if (i % 1000 == 0 || i == num_atoms - 1 || 0)
+		size_t num = frame.positions.size() / 3;
+		ptm_system_t system = {num, (const double (*)[3])frame.positions.data(), NULL, frame.has_cell ? frame.cell : NULL, {frame.pbc[0], frame.pbc[1], frame.pbc[2]}, 0, NULL};
+		nbrs.resize(num * max_nbrs);
+		types.resize(num);
+
+		std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+		ret = ptm_build_neighbour_table(&system, max_nbrs, num_threads, nbrs.data());
+		double seconds_neighbours = elapsed(t0);
+		if (ret != PTM_NO_ERROR)
+			break;
+
+		system.max_nbrs = max_nbrs;
+		system.nbrs = nbrs.data();
+
+		ptm_output_t output;
+		memset(&output, 0, sizeof(ptm_output_t));
+		output.mask = 0;		//structure types only
+		output.type = types.data();
+
+		t0 = std::chrono::steady_clock::now();
+		if (num_threads == 1)
+			ret = ptm_index_many(local_handle, &system, flags, false, INFINITY, warm_start, &output);
+		else
+			ret = ptm_index_many_threaded(&system, flags, false, INFINITY, num_threads, warm_start, &output, NULL);
+		double seconds_index = elapsed(t0);
+		if (ret != PTM_NO_ERROR)
+			break;
+
+		printf("%lu,%lld,%lu", (unsigned long)f, (long long)frame.timestep, (unsigned long)num);
+		print_type_counts(types.data(), num);
+		printf(",%.6f,%.6f\n", seconds_neighbours, seconds_index);
+
+		if (fout != NULL && fwrite(types.data(), sizeof(int32_t), num, fout) != num)
 		{
-			printf("counts: [");
-			for (int j = 0;j<9;j++)
-				printf("%d ", counts[j]);
-			printf("]\n");
+			fprintf(stderr, "cannot write %s\n", output_path);
+			ret = -1;
+			break;
 		}
 	}
 
-	printf("rmsd sum: %f\n", rmsd_sum);
+	if (fout != NULL)
+		fclose(fout);
+	if (warm_start != NULL)
+		ptm_uninitialize_warm_start(warm_start);
+	ptm_uninitialize_local(local_handle);
+	trajectory_close(&trajectory);
+	return ret;
+}
+
+static void print_usage(const char* program)
+{
+	fprintf(stderr, "usage: %s [-n cells] [-r repeats] [-t threads] [-s]\n", program);
+	fprintf(stderr, "       %s -T trajectory [-o types] [-a] [-w guard] [-t threads]\n", program);
+	fprintf(stderr, "       %s -p positions [-f] [-b nbrs -m max_nbrs] [-l lx,ly,lz] [-o types] [-a] [-S] [-t threads]\n", program);
+}
+
+int main(int argc, char** argv)
+{
+	int n = 8, num_repeats = 3, num_threads = 1;
+	bool run_tests = true;
+	const char* trajectory_path = NULL;
+	double guard_rmsd = 0;
+	fileoptions_t options = {NULL, false, NULL, 0, false, {0, 0, 0}, NULL, PTM_CHECK_DEFAULT, false, 1};
+	for (int i=1;i<argc;i++)
+	{
+		if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)		n = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)	num_repeats = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)	num_threads = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-s") == 0)			run_tests = false;
+		else if (strcmp(argv[i], "-T") == 0 && i + 1 < argc)	trajectory_path = argv[++i];
+		else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc)	guard_rmsd = atof(argv[++i]);
+		else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc)	options.positions_path = argv[++i];
+		else if (strcmp(argv[i], "-f") == 0)			options.single_precision = true;
+		else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc)	options.nbrs_path = argv[++i];
+		else if (strcmp(argv[i], "-m") == 0 && i + 1 < argc)	options.max_nbrs = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)	options.output_path = argv[++i];
+		else if (strcmp(argv[i], "-a") == 0)			options.flags = PTM_CHECK_ALL;
+		else if (strcmp(argv[i], "-S") == 0)			options.sequential = true;
+		else if (strcmp(argv[i], "-l") == 0 && i + 1 < argc)
+		{
+			double* l = options.lengths;
+			options.periodic = sscanf(argv[++i], "%lf,%lf,%lf", &l[0], &l[1], &l[2]) == 3 && l[0] > 0 && l[1] > 0 && l[2] > 0;
+			if (!options.periodic)
+			{
+				fprintf(stderr, "-l needs three positive cell lengths, got %s\n", argv[i]);
+				print_usage(argv[0]);
+				return -1;
+			}
+		}
+		else
+		{
+			print_usage(argv[0]);
+			return -1;
+		}
+	}
+
+	if (n <= 0 || num_repeats <= 0 || num_threads <= 0)
+	{
+		print_usage(argv[0]);
+		return -1;
+	}
+
+	ptm_initialize_global();
+	if (trajectory_path != NULL)
+		return index_trajectory(trajectory_path, options.flags, num_threads, options.output_path, guard_rmsd);
+
+	if (options.positions_path != NULL)
+	{
+		options.num_threads = num_threads;
+		return index_files(&options);
+	}
+
+	if (run_tests)
+	{
+		uint64_t res = ptm::run_tests();
+		assert(res == 0);
+		if (res != 0)
+			return -1;
+	}
+
+	//the stage and rejection columns are averages over the repeats, and are empty unless compiled with PTM_ENABLE_STATS
+	const char* stage_names[PTM_NUM_STAGES] = {"neighbours", "voronoi", "convex_hull", "canonical", "check_graphs", "output"};
+	const char* rejection_names[PTM_NUM_REJECTIONS] = {"facets", "degree", "hash", "rmsd"};
+
+	printf("structure,condition,flags,threads,num_atoms,num_matched,seconds_neighbours,seconds_index,ns_per_atom,atoms_per_second");
+	for (int i=0;i<PTM_NUM_STAGES;i++)
+		printf(",calls_%s,time_%s", stage_names[i], stage_names[i]);
+	for (int i=0;i<PTM_NUM_REJECTIONS;i++)
+		printf(",rejected_%s", rejection_names[i]);
+	printf("\n");
+
+	std::vector<ptm_stats_t> thread_stats(std::max(num_threads, 1));
+
+	ptm_local_handle_t local_handle = ptm_initialize_local();
+	systembuffer_t b;
+	for (int i=0;i<NUM_LATTICES;i++)
+	{
+		const latticedata_t* lattice = &lattices[i];
+		for (int j=0;j<NUM_CONDITIONS;j++)
+		{
+			generate_system(lattice, &conditions[j], n, 1000 * i + j, &b);
+
+			size_t num = num_atoms(&b);
+			ptm_system_t system = {num, (const double (*)[3])b.positions.data(), NULL, b.cell, {b.pbc[0], b.pbc[1], b.pbc[2]}, 0, NULL};
+			std::vector<int32_t> nbrs(num * (PTM_MAX_INPUT_POINTS - 1));
+			std::vector<int32_t> types(num);
+			std::vector<double> rmsd(num);
+
+			ptm_output_t output;
+			memset(&output, 0, sizeof(ptm_output_t));
+			output.mask = PTM_OUTPUT_RMSD;
+			output.type = types.data();
+			output.rmsd = rmsd.data();
+
+			int32_t all_flags[3] = {lattice->check, PTM_CHECK_DEFAULT, PTM_CHECK_ALL};
+			for (int k=0;k<3;k++)
+			{
+				int32_t flags = all_flags[k];
+				double best_neighbours = INFINITY, best_index = INFINITY;
+				ptm_stats_t stats;
+				memset(&stats, 0, sizeof(ptm_stats_t));
+				ptm_reset_stats(local_handle);
+				for (int r=0;r<num_repeats;r++)
+				{
+					std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+					int ret = ptm_build_neighbour_table(&system, PTM_MAX_INPUT_POINTS - 1, num_threads, nbrs.data());
+					best_neighbours = std::min(best_neighbours, elapsed(t0));
+					if (ret != PTM_NO_ERROR)
+						return ret;
+
+					ptm_system_t tabled = system;
+					tabled.max_nbrs = PTM_MAX_INPUT_POINTS - 1;
+					tabled.nbrs = nbrs.data();
+
+					t0 = std::chrono::steady_clock::now();
+					if (num_threads == 1)
+						ret = ptm_index_many(local_handle, &tabled, flags, false, INFINITY, NULL, &output);
+					else
+						ret = ptm_index_many_threaded(&tabled, flags, false, INFINITY, num_threads, NULL, &output, thread_stats.data());
+					best_index = std::min(best_index, elapsed(t0));
+					if (ret != PTM_NO_ERROR)
+						return ret;
+
+					if (num_threads != 1)
+						for (int t=0;t<num_threads;t++)
+							add_stats(&stats, &thread_stats[t]);
+				}
+
+				bool have_stats = true;
+				if (num_threads == 1)
+					have_stats = ptm_get_stats(local_handle, &stats) == PTM_NO_ERROR;
+				else
+					have_stats = stats.num_atoms > 0;
+
+				size_t num_matched = std::count(types.begin(), types.end(), lattice->type);
+				double total = best_neighbours + best_index;
+				printf("%s,%s,%s,%d,%lu,%lu,%.6f,%.6f,%.1f,%.0f",
+					lattice->name, conditions[j].name, flags_name(lattice, flags), num_threads,
+					(unsigned long)num, (unsigned long)num_matched,
+					best_neighbours, best_index, 1E9 * total / num, num / total);
+
+				for (int l=0;l<PTM_NUM_STAGES;l++)
+				{
+					if (have_stats)
+						printf(",%.0f,%.6f", (double)stats.calls[l] / num_repeats, stats.seconds[l] / num_repeats);
+					else
+						printf(",,");
+				}
+
+				for (int l=0;l<PTM_NUM_REJECTIONS;l++)
+				{
+					if (have_stats)
+						printf(",%.0f", (double)stats.rejected[l] / num_repeats);
+					else
+						printf(",");
+				}
+				printf("\n");
+			}
+		}
+	}
 
-	free(types);
-	free(rmsds);
-	free(quats);
-	free(positions);
-	free(nbrs);
 	ptm_uninitialize_local(local_handle);
 	return 0;
 }
-
@@ -0,0 +1,463 @@
+/*Copyright (c) 2016 PM Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <cmath>
+#include <cassert>
+#include <algorithm>
+#include <vector>
+#include "ptm_constants.h"
+#include "ptm_functions.h"
+#include "ptm_index.h"
+#include "ptm_batch.h"
+#include "ptm_parallel.h"
+#include "ptm_neighbour_search.h"
+#include "ptm_neighbour_ordering.h"
+#include "ptm_stats.h"
+
+
+#define PTM_BATCH_CHUNK_SIZE 256
+
+namespace ptm {
+
+static int gather_neighbours(const systemdata_t* data, size_t atom_index, int num, int* ordering, size_t* nbr_indices, int32_t* numbers, double (*nbr_pos)[3])
+{
+	const ptm_system_t* system = &data->system;
+	const double* x0 = system->positions[atom_index];
+	const int32_t* row = &system->nbrs[atom_index * system->max_nbrs];
+
+	ordering[0] = 0;
+	nbr_indices[0] = atom_index;
+	numbers[0] = system->numbers == NULL ? -1 : system->numbers[atom_index];
+	nbr_pos[0][0] = nbr_pos[0][1] = nbr_pos[0][2] = 0;
+
+	//neighbours already gathered into the first-shell table are copied
+	if (!data->shell_offsets.empty())
+	{
+		size_t begin = data->shell_offsets[atom_index];
+		int n = 1 + (int)std::min((size_t)(num - 1), data->shell_offsets[atom_index + 1] - begin);
+		for (int j=1;j<n;j++)
+		{
+			int32_t index = data->shell_indices[begin + j - 1];
+			ordering[j] = j;
+			nbr_indices[j] = index;
+			numbers[j] = system->numbers == NULL ? -1 : system->numbers[index];
+			memcpy(nbr_pos[j], &data->shell_deltas[3 * (begin + j - 1)], 3 * sizeof(double));
+		}
+
+		return n;
+	}
+
+	int n = 1;
+	int max_nbrs = std::min(num - 1, system->max_nbrs);
+	for (int j=0;j<max_nbrs;j++)
+	{
+		int32_t index = row[j];
+		if (index < 0)
+			break;
+
+		const double* x1 = system->positions[index];
+		double delta[3] = {x1[0] - x0[0], x1[1] - x0[1], x1[2] - x0[2]};
+		if (system->cell != NULL)
+			minimum_image(system->cell, data->inverse_cell, data->cell_widths, system->pbc, delta);
+
+		ordering[n] = j + 1;
+		nbr_indices[n] = index;
+		numbers[n] = system->numbers == NULL ? -1 : system->numbers[index];
+		memcpy(nbr_pos[n], delta, 3 * sizeof(double));
+		n++;
+	}
+
+	return n;
+}
+
+//callback used by the two-shell structures, which need the neighbours of neighbours
+static int get_table_neighbours(void* vdata, size_t _unused_lammps_variable, size_t atom_index, int num, int* ordering, size_t* nbr_indices, int32_t* numbers, double (*nbr_pos)[3])
+{
+	(void)_unused_lammps_variable;
+	return gather_neighbours((const systemdata_t*)vdata, atom_index, num, ordering, nbr_indices, numbers, nbr_pos);
+}
+
+int initialize_system_data(const ptm_system_t* system, int num_threads, systemdata_t* data)
+{
+	if (system->positions == NULL)
+		return -1;
+
+	if (system->nbrs != NULL && system->max_nbrs <= 0)
+		return -1;
+
+	data->system = *system;
+	if (system->cell != NULL)
+	{
+		if (!invert_matrix_3x3(system->cell, data->inverse_cell))
+			return -1;
+		perpendicular_widths(data->inverse_cell, data->cell_widths);
+	}
+
+	//no neighbour table given: find the neighbours with the cell-list search
+	if (system->nbrs == NULL)
+	{
+		int max_nbrs = PTM_MAX_INPUT_POINTS - 1;
+		data->table.resize(system->num_atoms * max_nbrs);
+		int ret = ptm_build_neighbour_table(system, max_nbrs, num_threads, data->table.data());
+		if (ret != PTM_NO_ERROR)
+			return ret;
+
+		data->system.max_nbrs = max_nbrs;
+		data->system.nbrs = data->table.data();
+	}
+
+	return PTM_NO_ERROR;
+}
+
+typedef struct
+{
+	systemdata_t* data;
+	int max_nbrs;
+	const size_t* offsets;
+} shelldata_t;
+
+static void fill_shell_table(void* vdata, int thread_index, size_t begin, size_t end)
+{
+	(void)thread_index;
+	shelldata_t* t = (shelldata_t*)vdata;
+	systemdata_t* data = t->data;
+
+	atomicenv_t env;
+	for (size_t i=begin;i<end;i++)
+	{
+		int num_points = gather_neighbours(data, i, t->max_nbrs + 1, env.ordering, env.nbr_indices, env.numbers, env.points);
+		size_t offset = t->offsets[i];
+		for (int j=1;j<num_points;j++)
+			data->shell_indices[offset + j - 1] = (int32_t)env.nbr_indices[j];
+		memcpy(&data->shell_deltas[3 * offset], env.points[1], 3 * (num_points - 1) * sizeof(double));
+	}
+}
+
+void build_shell_table(systemdata_t* data, int num_threads)
+{
+	const ptm_system_t* system = &data->system;
+	int max_nbrs = std::min(system->max_nbrs, PTM_MAX_INPUT_POINTS - 1);
+
+	std::vector<size_t> offsets(system->num_atoms + 1);
+	offsets[0] = 0;
+	for (size_t i=0;i<system->num_atoms;i++)
+	{
+		const int32_t* row = &system->nbrs[i * system->max_nbrs];
+		int n = 0;
+		while (n < max_nbrs && row[n] >= 0)
+			n++;
+
+		offsets[i + 1] = offsets[i] + n;
+	}
+
+	//the offsets are installed last, since gathering reads from the table once it exists
+	data->shell_offsets.clear();
+	data->shell_indices.resize(offsets[system->num_atoms]);
+	data->shell_deltas.resize(3 * offsets[system->num_atoms]);
+
+	shelldata_t t = {data, max_nbrs, offsets.data()};
+	parallel_for(system->num_atoms, PTM_BATCH_CHUNK_SIZE, num_threads, fill_shell_table, (void*)&t);
+	data->shell_offsets.swap(offsets);
+}
+
+static void initialize_output(ptm_output_t* output, size_t begin, size_t end)
+{
+	if ((output->mask & PTM_OUTPUT_INDICES) && output->output_indices != NULL)
+		memset(output->output_indices[begin], -1, (end - begin) * PTM_MAX_INPUT_POINTS * sizeof(int8_t));
+}
+
+void index_range(	ptm_local_handle_t local_handle, const systemdata_t* data, int32_t flags, bool output_conventional_orientation, double max_rmsd,
+			ptm_warm_start_t warm_start, ptm_output_t* output, size_t begin, size_t end)
+{
+	ptm_stats_t* stats = local_stats(local_handle);
+	initialize_output(output, begin, end);
+
+	bool single_shell = flags & (PTM_CHECK_SC | PTM_CHECK_FCC | PTM_CHECK_HCP | PTM_CHECK_ICO | PTM_CHECK_BCC);
+
+	//columns which are not requested are not computed
+	int32_t mask = output->mask;
+	int32_t* out_alloy_type = (mask & PTM_OUTPUT_ALLOY) ? output->alloy_type : NULL;
+	double* out_scale = (mask & PTM_OUTPUT_SCALE) ? output->scale : NULL;
+	double* out_rmsd = (mask & PTM_OUTPUT_RMSD) ? output->rmsd : NULL;
+	double* out_interatomic_distance = (mask & PTM_OUTPUT_INTERATOMIC_DISTANCE) ? output->interatomic_distance : NULL;
+	double* out_lattice_constant = (mask & PTM_OUTPUT_LATTICE_CONSTANT) ? output->lattice_constant : NULL;
+	double (*out_q)[4] = (mask & PTM_OUTPUT_QUAT) ? output->q : NULL;
+	int* out_best_template_index = (mask & PTM_OUTPUT_TEMPLATE_INDEX) ? output->best_template_index : NULL;
+	double (*out_F)[9] = (mask & PTM_OUTPUT_F) ? output->F : NULL;
+	double (*out_F_res)[3] = (mask & PTM_OUTPUT_F) ? output->F_res : NULL;
+	double (*out_U)[9] = (mask & PTM_OUTPUT_STRAIN) ? output->U : NULL;
+	double (*out_P)[9] = (mask & PTM_OUTPUT_STRAIN) ? output->P : NULL;
+	int8_t (*out_indices)[PTM_MAX_INPUT_POINTS] = (mask & PTM_OUTPUT_INDICES) ? output->output_indices : NULL;
+
+	bool need_F = out_F != NULL || out_F_res != NULL || out_U != NULL || out_P != NULL;
+	bool need_polar = out_U != NULL || out_P != NULL;
+
+	for (size_t i=begin;i<end;i++)
+	{
+		atomicenv_t env;
+		int num_points = 0;
+		if (single_shell)
+		{
+			PTM_STATS_START(start);
+			num_points = gather_neighbours(data, i, PTM_MAX_INPUT_POINTS, env.ordering, env.nbr_indices, env.numbers, env.points);
+			PTM_STATS_STOP(stats, PTM_STAGE_NEIGHBOURS, start);
+		}
+
+		int32_t type = PTM_MATCH_NONE, alloy_type = PTM_ALLOY_NONE;
+		int best_template_index = 0;
+		double scale, rmsd, q[4], F[9], F_res[3], U[9], P[9];
+		double interatomic_distance, lattice_constant;
+
+		index_atom(	stats, i, num_points, &env, get_table_neighbours, (void*)data,
+				flags, output_conventional_orientation, max_rmsd,
+				warm_start == NULL ? NULL : &warm_start->atoms[i], warm_start == NULL ? 0 : warm_start->guard_rmsd,
+				&type, out_alloy_type == NULL ? NULL : &alloy_type,
+				out_scale == NULL ? NULL : &scale, out_rmsd == NULL ? NULL : &rmsd,
+				out_q == NULL ? NULL : q,
+				need_F ? F : NULL, need_F ? F_res : NULL, need_polar ? U : NULL, need_polar ? P : NULL,
+				out_interatomic_distance == NULL ? NULL : &interatomic_distance,
+				out_lattice_constant == NULL ? NULL : &lattice_constant,
+				out_best_template_index == NULL ? NULL : &best_template_index, NULL,
+				out_indices == NULL ? NULL : out_indices[i]);
+
+		//unmatched rows are written too, with the values of the LAMMPS compute
+		if (type == PTM_MATCH_NONE)
+		{
+			alloy_type = PTM_ALLOY_NONE;
+			best_template_index = 0;
+			scale = interatomic_distance = lattice_constant = 0;
+			rmsd = INFINITY;
+			memset(q, 0, 4 * sizeof(double));
+			memset(F, 0, 9 * sizeof(double));
+			memset(F_res, 0, 3 * sizeof(double));
+			memset(U, 0, 9 * sizeof(double));
+			memset(P, 0, 9 * sizeof(double));
+		}
+
+		output->type[i] = type;
+		if (out_alloy_type != NULL)		out_alloy_type[i] = alloy_type;
+		if (out_scale != NULL)			out_scale[i] = scale;
+		if (out_rmsd != NULL)			out_rmsd[i] = rmsd;
+		if (out_q != NULL)			memcpy(out_q[i], q, 4 * sizeof(double));
+		if (out_F != NULL)			memcpy(out_F[i], F, 9 * sizeof(double));
+		if (out_F_res != NULL)			memcpy(out_F_res[i], F_res, 3 * sizeof(double));
+		if (out_U != NULL)			memcpy(out_U[i], U, 9 * sizeof(double));
+		if (out_P != NULL)			memcpy(out_P[i], P, 9 * sizeof(double));
+		if (out_interatomic_distance != NULL)	out_interatomic_distance[i] = interatomic_distance;
+		if (out_lattice_constant != NULL)	out_lattice_constant[i] = lattice_constant;
+		if (out_best_template_index != NULL)	out_best_template_index[i] = best_template_index;
+	}
+}
+
+void order_range(ptm_local_handle_t local_handle, const systemdata_t* data, int max_nbrs, int32_t* nbrs, size_t begin, size_t end)
+{
+	for (size_t i=begin;i<end;i++)
+	{
+		atomicenv_t env;
+		int num_nbrs = gather_neighbours(data, i, PTM_MAX_INPUT_POINTS, env.ordering, env.nbr_indices, env.numbers, env.points) - 1;
+
+		//if the Voronoi cell cannot be found the neighbours are left in order of distance
+		int ordering[PTM_MAX_INPUT_POINTS];
+		for (int j=0;j<num_nbrs;j++)
+			ordering[j] = j;
+
+		if (num_nbrs > 0)
+		{
+			PTM_STATS_START(start);
+			calculate_voronoi_ordering(local_handle->voronoi_handle, num_nbrs, &env.points[1], ordering);
+			PTM_STATS_STOP(local_stats(local_handle), PTM_STAGE_VORONOI, start);
+		}
+
+		int32_t* row = &nbrs[i * max_nbrs];
+		int n = std::min(num_nbrs, max_nbrs);
+		for (int j=0;j<n;j++)
+			row[j] = (int32_t)env.nbr_indices[1 + ordering[j]];
+
+		for (int j=n;j<max_nbrs;j++)
+			row[j] = -1;
+	}
+}
+
+}
+
+ptm_warm_start_t ptm_initialize_warm_start(double guard_rmsd)
+{
+	ptm_warm_start_t warm_start = new ptm_warm_start;
+	warm_start->guard_rmsd = guard_rmsd;
+	return warm_start;
+}
+
+void ptm_uninitialize_warm_start(ptm_warm_start_t warm_start)
+{
+	delete warm_start;
+}
+
+//stored matches only carry over to a system of the same atoms
+static void prepare_warm_start(ptm_warm_start_t warm_start, size_t num_atoms)
+{
+	if (warm_start == NULL || warm_start->atoms.size() == num_atoms)
+		return;
+
+	ptm::warmatom_t empty;
+	memset(&empty, 0, sizeof(ptm::warmatom_t));
+	empty.type = PTM_MATCH_NONE;
+	warm_start->atoms.assign(num_atoms, empty);
+}
+
+int ptm_index_many(	ptm_local_handle_t local_handle, const ptm_system_t* system,
+			int32_t flags, bool output_conventional_orientation, double max_rmsd,
+			ptm_warm_start_t warm_start, ptm_output_t* output)
+{
+	assert(ptm::initialized);
+	if (!ptm::initialized)
+		return -1;
+
+	if (output->type == NULL)
+		return -1;
+
+	//neighbour and first-shell tables built here are counted as one neighbour gathering call
+	PTM_STATS_START(start);
+	ptm::systemdata_t data;
+	int ret = ptm::initialize_system_data(system, 1, &data);
+	if (ret != PTM_NO_ERROR)
+		return ret;
+
+	//the two-shell structures visit every first shell several times, so it is gathered once
+	if (flags & (PTM_CHECK_DCUB | PTM_CHECK_DHEX | PTM_CHECK_GRAPHENE))
+		ptm::build_shell_table(&data, 1);
+
+	if (system->nbrs == NULL || (flags & (PTM_CHECK_DCUB | PTM_CHECK_DHEX | PTM_CHECK_GRAPHENE)))
+		PTM_STATS_STOP(ptm::local_stats(local_handle), PTM_STAGE_NEIGHBOURS, start);
+
+	prepare_warm_start(warm_start, system->num_atoms);
+	ptm::index_range(local_handle, &data, flags, output_conventional_orientation, max_rmsd, warm_start, output, 0, system->num_atoms);
+	return PTM_NO_ERROR;
+}
+
+typedef struct
+{
+	const ptm::systemdata_t* data;
+	int32_t flags;
+	bool output_conventional_orientation;
+	double max_rmsd;
+	ptm_warm_start_t warm_start;
+	ptm_output_t* output;
+	ptm_local_handle_t* local_handles;
+} threaddata_t;
+
+static void index_chunk(void* vdata, int thread_index, size_t begin, size_t end)
+{
+	threaddata_t* t = (threaddata_t*)vdata;
+	ptm::index_range(	t->local_handles[thread_index], t->data, t->flags, t->output_conventional_orientation, t->max_rmsd,
+				t->warm_start, t->output, begin, end);
+}
+
+int ptm_index_many_threaded(	const ptm_system_t* system,
+				int32_t flags, bool output_conventional_orientation, double max_rmsd, int num_threads,
+				ptm_warm_start_t warm_start, ptm_output_t* output, ptm_stats_t* thread_stats)
+{
+	assert(ptm::initialized);
+	if (!ptm::initialized)
+		return -1;
+
+	if (output->type == NULL)
+		return -1;
+
+	//the caller must know the number of threads to size thread_stats
+	if (thread_stats != NULL && num_threads <= 0)
+		return -1;
+
+	if (num_threads <= 0)
+		num_threads = ptm::default_num_threads();
+
+	std::vector<ptm_local_handle_t> local_handles(num_threads);
+	for (int i=0;i<num_threads;i++)
+		local_handles[i] = ptm_initialize_local();
+
+	//neighbour and first-shell tables built here are counted as one neighbour gathering call of the first thread
+	PTM_STATS_START(start);
+	ptm::systemdata_t data;
+	int ret = ptm::initialize_system_data(system, num_threads, &data);
+	if (ret != PTM_NO_ERROR)
+	{
+		for (int i=0;i<num_threads;i++)
+			ptm_uninitialize_local(local_handles[i]);
+		return ret;
+	}
+
+	if (flags & (PTM_CHECK_DCUB | PTM_CHECK_DHEX | PTM_CHECK_GRAPHENE))
+		ptm::build_shell_table(&data, num_threads);
+
+	if (system->nbrs == NULL || (flags & (PTM_CHECK_DCUB | PTM_CHECK_DHEX | PTM_CHECK_GRAPHENE)))
+		PTM_STATS_STOP(ptm::local_stats(local_handles[0]), PTM_STAGE_NEIGHBOURS, start);
+
+	//small chunks keep the threads balanced, since the cost per atom depends on its structure
+	size_t chunk_size = system->num_atoms / ((size_t)num_threads * 16);
+	chunk_size = std::max((size_t)1, std::min(chunk_size, (size_t)PTM_BATCH_CHUNK_SIZE));
+
+	prepare_warm_start(warm_start, system->num_atoms);
+	threaddata_t t = {&data, flags, output_conventional_orientation, max_rmsd, warm_start, output, local_handles.data()};
+	ptm::parallel_for(system->num_atoms, chunk_size, num_threads, index_chunk, (void*)&t);
+
+	for (int i=0;i<num_threads;i++)
+	{
+		if (thread_stats != NULL)
+			ptm_get_stats(local_handles[i], &thread_stats[i]);
+		ptm_uninitialize_local(local_handles[i]);
+	}
+
+	return PTM_NO_ERROR;
+}
+
+
+typedef struct
+{
+	const ptm::systemdata_t* data;
+	int max_nbrs;
+	int32_t* nbrs;
+	ptm_local_handle_t* local_handles;
+} orderdata_t;
+
+static void order_chunk(void* vdata, int thread_index, size_t begin, size_t end)
+{
+	orderdata_t* t = (orderdata_t*)vdata;
+	ptm::order_range(t->local_handles[thread_index], t->data, t->max_nbrs, t->nbrs, begin, end);
+}
+
+int ptm_preorder_neighbour_table(	const ptm_system_t* system, int max_nbrs, int num_threads,
+					int32_t* nbrs)
+{
+	assert(ptm::initialized);
+	if (!ptm::initialized)
+		return -1;
+
+	if (max_nbrs <= 0 || max_nbrs >= PTM_MAX_INPUT_POINTS || system->nbrs == nbrs)
+		return -1;
+
+	if (num_threads <= 0)
+		num_threads = ptm::default_num_threads();
+
+	ptm::systemdata_t data;
+	int ret = ptm::initialize_system_data(system, num_threads, &data);
+	if (ret != PTM_NO_ERROR)
+		return ret;
+
+	std::vector<ptm_local_handle_t> local_handles(num_threads);
+	for (int i=0;i<num_threads;i++)
+		local_handles[i] = ptm_initialize_local();
+
+	orderdata_t t = {&data, max_nbrs, nbrs, local_handles.data()};
+	ptm::parallel_for(system->num_atoms, PTM_BATCH_CHUNK_SIZE, num_threads, order_chunk, (void*)&t);
+
+	for (int i=0;i<num_threads;i++)
+		ptm_uninitialize_local(local_handles[i]);
+
+	return PTM_NO_ERROR;
+}
@@ -0,0 +1,50 @@
+/*Copyright (c) 2016 PM Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef PTM_BATCH_H
+#define PTM_BATCH_H
+
+#include <cstddef>
+#include <vector>
+#include "ptm_functions.h"
+#include "ptm_index.h"
+
+//per-atom matches behind ptm_warm_start_t
+struct ptm_warm_start
+{
+	double guard_rmsd;
+	std::vector<ptm::warmatom_t> atoms;
+};
+
+namespace ptm {
+
+typedef struct
+{
+	ptm_system_t system;		//copy of the input, with nbrs pointing to the neighbour table in use
+	std::vector<int32_t> table;	//neighbour table found by the cell-list search, if none was given
+	double inverse_cell[9];
+	double cell_widths[3];
+
+	//first-shell table, in compressed row form: the neighbours of atom i are entries
+	//shell_offsets[i] to shell_offsets[i + 1], with their displacements from atom i
+	std::vector<size_t> shell_offsets;
+	std::vector<int32_t> shell_indices;
+	std::vector<double> shell_deltas;
+} systemdata_t;
+
+int initialize_system_data(const ptm_system_t* system, int num_threads, systemdata_t* data);
+void build_shell_table(systemdata_t* data, int num_threads);
+void index_range(	ptm_local_handle_t local_handle, const systemdata_t* data, int32_t flags, bool output_conventional_orientation, double max_rmsd,
+			ptm_warm_start_t warm_start, ptm_output_t* output, size_t begin, size_t end);
+void order_range(ptm_local_handle_t local_handle, const systemdata_t* data, int max_nbrs, int32_t* nbrs, size_t begin, size_t end);
+
+}
+
+#endif
+
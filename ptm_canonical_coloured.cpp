@@ -15,52 +15,44 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 namespace ptm {
 
+//Compares two codes of equal length lexicographically.  Code entries are non-negative, so an
+//unsigned byte comparison gives the same order and can be done with wide loads.
+static inline int compare_codes(const int8_t* a, const int8_t* b, int length)
+{
+        return memcmp(a, b, length);
+}
+
+//Generates the Weinberg code of the traversal starting on the directed edge (a, b), and keeps it
+//if it is smaller than the best code so far.  Edge-visited state is a bitset per vertex: bit b of
+//m[a] is set once a->b has been traversed.
 static bool weinberg_coloured(int num_nodes, int num_edges, int8_t common[PTM_MAX_NBRS][PTM_MAX_NBRS], int8_t* colours, int8_t* best_code, int8_t* canonical_labelling, int a, int b)
 {
-        bool m[PTM_MAX_NBRS][PTM_MAX_NBRS];
-        memset(m, 0, sizeof(bool) * PTM_MAX_NBRS * PTM_MAX_NBRS);
+        uint16_t m[PTM_MAX_NBRS] = {0};
 
         int8_t index[PTM_MAX_NBRS];
         memset(index, -1, sizeof(int8_t) * PTM_MAX_NBRS);
 
+        int8_t code[2 * PTM_MAX_EDGES];
+        int length = 2 * num_edges;
 
         int n = 0;
         index[a] = colours[a] * num_nodes + n++;
-        if (index[a] > best_code[0])
+        code[0] = index[a];
+        if (code[0] > best_code[0])
                 return false;
 
-        bool winning = false;
-        if (index[a] < best_code[0])
-        {
-                best_code[0] = index[a];
-                winning = true;
-        }
-
-        int c = -1;
-        for (int it=1;it<2*num_edges;it++)
+        for (int it=1;it<length;it++)
         {
-                bool newvertex = index[b] == -1;
-
-                if (newvertex)
-                        index[b] = colours[b] * num_nodes + n++;
-
-                if (!winning && index[b] > best_code[it])
-                        return false;
-
-                if (winning || index[b] < best_code[it])
-                {
-                        winning = true;
-                        best_code[it] = index[b];
-                }
-
-                if (newvertex)
+                int c;
+                if (index[b] == -1)
                 {
                         //When a new vertex is reached, take the right-most edge
                         //relative to the edge on which the vertex is reached.
 
+                        index[b] = colours[b] * num_nodes + n++;
                         c = common[a][b];
                 }
-                else if (m[b][a] == false)
+                else if (!(m[b] & (1 << a)))
                 {
                         //When an old vertex is reached on a new path, go back
                         //in the opposite direction.
@@ -74,33 +66,31 @@ static bool weinberg_coloured(int num_nodes, int num_edges, int8_t common[PTM_MA
                         //been traversed in that direction.
 
                         c = common[a][b];
-                        while (m[b][c] == true)
+                        while (m[b] & (1 << c))
                                 c = common[c][b];
                 }
 
-                m[a][b] = true;
+                code[it] = index[b];
+
+                m[a] |= 1 << b;
                 a = b;
                 b = c;
         }
 
-        if (winning)
-        {
-                memcpy(canonical_labelling, index, sizeof(int8_t) * num_nodes);
-                return true;
-        }
+        if (compare_codes(code, best_code, length) >= 0)
+                return false;
 
-        return false;
+        memcpy(best_code, code, sizeof(int8_t) * length);
+        memcpy(canonical_labelling, index, sizeof(int8_t) * num_nodes);
+        return true;
 }
 
-int canonical_form_coloured(int num_facets, int8_t facets[][3], int num_nodes, int8_t* degree, int8_t* colours, int8_t* canonical_labelling, int8_t* best_code, uint64_t* p_hash)
+//Directed edges on which a canonical traversal may start.  For a graph with uniform degrees and
+//colours any edge will do.  Otherwise the start edges are those which begin a facet with the
+//lexicographically largest degree signature (degree of the start vertex, the end vertex and the
+//third vertex); these are collected in a single pass over the facets.
+static int start_edges(int num_facets, int8_t facets[][3], int num_nodes, int8_t* degree, int8_t* colours, int8_t (*edges)[2])
 {
-        int8_t common[PTM_MAX_NBRS][PTM_MAX_NBRS] = {{0}};
-        int num_edges = 3 * num_facets / 2;
-        if (!build_facet_map(num_facets, facets, common))
-                return -1;
-
-        memset(best_code, SCHAR_MAX, sizeof(int8_t) * 2 * PTM_MAX_EDGES);
-
         bool equal = true;
         for (int i = 1;i<num_nodes;i++)
                 if (degree[i] != degree[0] || colours[i] != colours[0])
@@ -108,54 +98,52 @@ int canonical_form_coloured(int num_facets, int8_t facets[][3], int num_nodes, i
 
         if (equal)
         {
-                weinberg_coloured(num_nodes, num_edges, common, colours, best_code, canonical_labelling, facets[0][0], facets[0][1]);
+                edges[0][0] = facets[0][0];
+                edges[0][1] = facets[0][1];
+                return 1;
         }
-        else
+
+        int num_edges = 0;
+        uint32_t best_degree = 0;
+        for (int i = 0;i<num_facets;i++)
         {
-                uint32_t best_degree = 0;
-                for (int i = 0;i<num_facets;i++)
+                for (int j = 0;j<3;j++)
                 {
-                        int a = facets[i][0];
-                        int b = facets[i][1];
-                        int c = facets[i][2];
-
-                        //int da = colours[a] * num_nodes + degree[a];
-                        //int db = colours[b] * num_nodes + degree[b];
-                        //int dc = colours[c] * num_nodes + degree[c];
-
-                        int da = degree[a];
-                        int db = degree[b];
-                        int dc = degree[c];
-
-                        best_degree = std::max(best_degree, ((uint32_t)da << 16) | ((uint32_t)db << 8) | ((uint32_t)dc << 0));
-                        best_degree = std::max(best_degree, ((uint32_t)da << 0) | ((uint32_t)db << 16) | ((uint32_t)dc << 8));
-                        best_degree = std::max(best_degree, ((uint32_t)da << 8) | ((uint32_t)db << 0) | ((uint32_t)dc << 16));
+                        int a = facets[i][j];
+                        int b = facets[i][(j + 1) % 3];
+                        int c = facets[i][(j + 2) % 3];
+                        uint32_t signature = ((uint32_t)degree[a] << 16) | ((uint32_t)degree[b] << 8) | (uint32_t)degree[c];
+                        if (signature < best_degree)
+                                continue;
+
+                        if (signature > best_degree)
+                        {
+                                best_degree = signature;
+                                num_edges = 0;
+                        }
+
+                        edges[num_edges][0] = a;
+                        edges[num_edges][1] = b;
+                        num_edges++;
                 }
+        }
 
-                for (int i = 0;i<num_facets;i++)
-                {
-                        int a = facets[i][0];
-                        int b = facets[i][1];
-                        int c = facets[i][2];
-
-                        //int da = colours[a] * num_nodes + degree[a];
-                        //int db = colours[b] * num_nodes + degree[b];
-                        //int dc = colours[c] * num_nodes + degree[c];
-
-                        int da = degree[a];
-                        int db = degree[b];
-                        int dc = degree[c];
+        return num_edges;
+}
 
-                        if (best_degree == (((uint32_t)da << 16) | ((uint32_t)db << 8) | ((uint32_t)dc << 0)))
-                                weinberg_coloured(num_nodes, num_edges, common, colours, best_code, canonical_labelling, a, b);
+int canonical_form_coloured(int num_facets, int8_t facets[][3], int num_nodes, int8_t* degree, int8_t* colours, int8_t* canonical_labelling, int8_t* best_code, uint64_t* p_hash)
+{
+        int8_t common[PTM_MAX_NBRS][PTM_MAX_NBRS] = {{0}};
+        int num_edges = 3 * num_facets / 2;
+        if (!build_facet_map(num_facets, facets, common))
+                return -1;
 
-                        if (best_degree == (((uint32_t)da << 0) | ((uint32_t)db << 16) | ((uint32_t)dc << 8)))
-                                weinberg_coloured(num_nodes, num_edges, common, colours, best_code, canonical_labelling, b, c);
+        memset(best_code, SCHAR_MAX, sizeof(int8_t) * 2 * PTM_MAX_EDGES);
 
-                        if (best_degree == (((uint32_t)da << 8) | ((uint32_t)db << 0) | ((uint32_t)dc << 16)))
-                                weinberg_coloured(num_nodes, num_edges, common, colours, best_code, canonical_labelling, c, a);
-                }
-        }
+        int8_t edges[3 * PTM_MAX_FACETS][2];
+        int num_start = start_edges(num_facets, facets, num_nodes, degree, colours, edges);
+        for (int i = 0;i<num_start;i++)
+                weinberg_coloured(num_nodes, num_edges, common, colours, best_code, canonical_labelling, edges[i][0], edges[i][1]);
 
         for (int i = num_nodes-1;i>=0;i--)
                 canonical_labelling[i+1] = (canonical_labelling[i] % num_nodes) + 1;
@@ -29,6 +29,21 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #define PTM_CHECK_DEFAULT       (PTM_CHECK_FCC | PTM_CHECK_HCP | PTM_CHECK_ICO | PTM_CHECK_BCC)
 #define PTM_CHECK_ALL           (PTM_CHECK_SC | PTM_CHECK_FCC | PTM_CHECK_HCP | PTM_CHECK_ICO | PTM_CHECK_BCC | PTM_CHECK_DCUB | PTM_CHECK_DHEX | PTM_CHECK_GRAPHENE)
 
+#define PTM_SINGLE_PRECISION    (1 << 16)       //screen candidate mappings in single precision; the best is refined in double
+
+#define PTM_OUTPUT_RMSD         (1 << 1)
+#define PTM_OUTPUT_QUAT         (1 << 2)
+#define PTM_OUTPUT_F            (1 << 3)        //deformation gradient and residual
+#define PTM_OUTPUT_STRAIN       (1 << 4)        //polar decomposition of the deformation gradient
+#define PTM_OUTPUT_ALLOY        (1 << 5)
+#define PTM_OUTPUT_INDICES      (1 << 6)
+#define PTM_OUTPUT_SCALE        (1 << 7)
+#define PTM_OUTPUT_INTERATOMIC_DISTANCE (1 << 8)
+#define PTM_OUTPUT_LATTICE_CONSTANT     (1 << 9)
+#define PTM_OUTPUT_TEMPLATE_INDEX       (1 << 10)       //index of the best (alternative) template
+#define PTM_OUTPUT_ALL          (PTM_OUTPUT_RMSD | PTM_OUTPUT_QUAT | PTM_OUTPUT_F | PTM_OUTPUT_STRAIN | PTM_OUTPUT_ALLOY | PTM_OUTPUT_INDICES \
+                                | PTM_OUTPUT_SCALE | PTM_OUTPUT_INTERATOMIC_DISTANCE | PTM_OUTPUT_LATTICE_CONSTANT | PTM_OUTPUT_TEMPLATE_INDEX)
+
 #define PTM_MATCH_NONE          0
 #define PTM_MATCH_FCC           1
 #define PTM_MATCH_HCP           2
@@ -48,6 +63,20 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #define PTM_ALLOY_SIC           6
 #define PTM_ALLOY_BN            7
 
+#define PTM_STAGE_NEIGHBOURS    0       //stages timed when compiled with PTM_ENABLE_STATS
+#define PTM_STAGE_VORONOI       1
+#define PTM_STAGE_CONVEX_HULL   2
+#define PTM_STAGE_CANONICAL     3
+#define PTM_STAGE_CHECK_GRAPHS  4
+#define PTM_STAGE_OUTPUT        5
+#define PTM_NUM_STAGES          6
+
+#define PTM_REJECT_FACETS       0       //convex hull is degenerate or has the wrong number of facets
+#define PTM_REJECT_DEGREE       1       //a vertex of the convex hull exceeds the maximum degree
+#define PTM_REJECT_HASH         2       //no template graph has the canonical hash
+#define PTM_REJECT_RMSD         3       //no mapping beats the RMSD cutoff or an earlier match
+#define PTM_NUM_REJECTIONS      4
+
 
 #define PTM_MAX_INPUT_POINTS    19
 #define PTM_MAX_NBRS            16
@@ -17,9 +17,6 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 namespace ptm {
 
-#define VISIBLE 1
-#define INVISIBLE 2
-#define BOTH 3
 #define TOLERANCE 1E-8
 
 static double norm_squared(double* p)
@@ -222,9 +219,66 @@ void add_facet(const double (*points)[3], int a, int b, int c, int8_t* facet, do
         }
 }
 
-static int initialize_convex_hull(int num_points, const double (*points)[3], int8_t facets[][3], double plane_normal[][3], bool* processed, int* initial_vertices, double* barycentre)
+//adds the facet (a, b, c) to the hull, oriented away from the barycentre
+static void add_hull_facet(const double (*points)[3], int a, int b, int c, convexhull_t* ch)
 {
-        memset(processed, 0, PTM_MAX_POINTS * sizeof(bool));
+        int j = ch->num_facets++;
+        double plane_normal[3];
+        add_facet(points, a, b, c, ch->facets[j], plane_normal, ch->barycentre);
+
+        const double* plane_point = points[ch->facets[j][0]];
+        for (int k = 0;k<3;k++)
+        {
+                ch->normal[k][j] = plane_normal[k];
+                ch->plane_point[k][j] = plane_point[k];
+        }
+}
+
+static void remove_hull_facet(convexhull_t* ch, int j)
+{
+        int last = --ch->num_facets;
+        memcpy(ch->facets[j], ch->facets[last], 3 * sizeof(int8_t));
+        for (int k = 0;k<3;k++)
+        {
+                ch->normal[k][j] = ch->normal[k][last];
+                ch->plane_point[k][j] = ch->plane_point[k][last];
+        }
+}
+
+//index of the lowest set bit of a non-zero mask
+static int lowest_bit(uint32_t mask)
+{
+#ifdef __GNUC__
+        return __builtin_ctz(mask);
+#else
+        int i = 0;
+        while (!((mask >> i) & 1))
+                i++;
+        return i;
+#endif
+}
+
+//bitmask of the facets which are visible from w
+static uint32_t visible_facets(const convexhull_t* ch, const double* w)
+{
+        double distance[PTM_MAX_FACETS];
+        for (int j = 0;j<ch->num_facets;j++)
+                distance[j] =   ch->normal[0][j] * (ch->plane_point[0][j] - w[0])
+                              + ch->normal[1][j] * (ch->plane_point[1][j] - w[1])
+                              + ch->normal[2][j] * (ch->plane_point[2][j] - w[2]);
+
+        uint32_t mask = 0;
+        for (int j = 0;j<ch->num_facets;j++)
+                mask |= (uint32_t)(distance[j] > TOLERANCE) << j;
+        return mask;
+}
+
+static int initialize_convex_hull(int num_points, const double (*points)[3], convexhull_t* ch)
+{
+        int* initial_vertices = ch->initial_vertices;
+        double* barycentre = ch->barycentre;
+
+        memset(ch->processed, 0, PTM_MAX_POINTS * sizeof(bool));
         memset(barycentre, 0, 3 * sizeof(double));
         int ret = initial_simplex(num_points, points, initial_vertices);
         if (ret != 0)
@@ -233,7 +287,7 @@ static int initialize_convex_hull(int num_points, const double (*points)[3], int
         for (int i = 0;i<4;i++)
         {
                 int a = initial_vertices[i];
-                processed[a] = true;
+                ch->processed[a] = true;
 
                 barycentre[0] += points[a][0];
                 barycentre[1] += points[a][1];
@@ -243,10 +297,11 @@ static int initialize_convex_hull(int num_points, const double (*points)[3], int
         barycentre[1] /= 4;
         barycentre[2] /= 4;
 
-        add_facet(points, initial_vertices[0], initial_vertices[1], initial_vertices[2], facets[0], plane_normal[0], barycentre);
-        add_facet(points, initial_vertices[0], initial_vertices[1], initial_vertices[3], facets[1], plane_normal[1], barycentre);
-        add_facet(points, initial_vertices[0], initial_vertices[2], initial_vertices[3], facets[2], plane_normal[2], barycentre);
-        add_facet(points, initial_vertices[1], initial_vertices[2], initial_vertices[3], facets[3], plane_normal[3], barycentre);
+        ch->num_facets = 0;
+        add_hull_facet(points, initial_vertices[0], initial_vertices[1], initial_vertices[2], ch);
+        add_hull_facet(points, initial_vertices[0], initial_vertices[1], initial_vertices[3], ch);
+        add_hull_facet(points, initial_vertices[0], initial_vertices[2], initial_vertices[3], ch);
+        add_hull_facet(points, initial_vertices[1], initial_vertices[2], initial_vertices[3], ch);
         return 0;
 }
 
@@ -265,11 +320,10 @@ int get_convex_hull(int num_points, const double (*points)[3], convexhull_t* ch,
         ch->num_prev = num_points;
         if (!ch->ok || 0)
         {
-                ret = initialize_convex_hull(num_points, points, ch->facets, ch->plane_normal, ch->processed, ch->initial_vertices, ch->barycentre);
+                ret = initialize_convex_hull(num_points, points, ch);
                 if (ret != 0)
                         return ret;
 
-                ch->num_facets = 4;
                 num_prev = 0;
         }
 
@@ -279,79 +333,54 @@ int get_convex_hull(int num_points, const double (*points)[3], convexhull_t* ch,
                         continue;
                 ch->processed[i] = true;
 
+                //points inside the current hull leave it unchanged
+                uint32_t visible = visible_facets(ch, points[i]);
+                if (visible == 0)
+                        continue;
+
+                //The facets are oriented consistently, so the facet on the other side of the directed
+                //edge (a, b) contains the edge (b, a).  Collect the directed edges of the visible facets
+                //as a bitset per vertex (bit b of edges_visible[a] is set for the edge (a, b)); the
+                //horizon consists of the visible edges whose reverse is not visible.
+                uint32_t edges_visible[PTM_MAX_POINTS] = {0};
+                for (uint32_t m = visible;m != 0;m &= m - 1)
+                {
+                        const int8_t* f = ch->facets[lowest_bit(m)];
+                        edges_visible[f[0]] |= 1u << f[1];
+                        edges_visible[f[1]] |= 1u << f[2];
+                        edges_visible[f[2]] |= 1u << f[0];
+                }
+
                 int num_to_add = 0;
                 int8_t to_add[PTM_MAX_FACETS][3];
-                int8_t edge_visible[PTM_MAX_POINTS][PTM_MAX_POINTS];
-                memset(edge_visible, 0, sizeof(int8_t) * PTM_MAX_POINTS * PTM_MAX_POINTS);
-                for (int j = 0;j<ch->num_facets;j++)
+                for (uint32_t m = visible;m != 0;m &= m - 1)
                 {
-                        int a = ch->facets[j][0];
-                        int b = ch->facets[j][1];
-                        int c = ch->facets[j][2];
-
-                        int u = 0, v = 0, w = 0;
-
-                        double distance = point_plane_distance(points[i], points[a], ch->plane_normal[j]);
-                        bool vis = distance > TOLERANCE;
-                        if (vis)
+                        const int8_t* f = ch->facets[lowest_bit(m)];
+                        for (int k = 0;k<3;k++)
                         {
-                                u = edge_visible[a][b] |= VISIBLE;
-                                edge_visible[b][a] |= VISIBLE;
-
-                                v = edge_visible[b][c] |= VISIBLE;
-                                edge_visible[c][b] |= VISIBLE;
-
-                                w = edge_visible[c][a] |= VISIBLE;
-                                edge_visible[a][c] |= VISIBLE;
-
-                                memcpy(ch->facets[j], ch->facets[ch->num_facets-1], 3 * sizeof(int8_t));
-                                memcpy(ch->plane_normal[j], ch->plane_normal[ch->num_facets-1], 3 * sizeof(double));
-                                ch->num_facets--;
-                                j--;
-                        }
-                        else
-                        {
-                                u = edge_visible[a][b] |= INVISIBLE;
-                                edge_visible[b][a] |= INVISIBLE;
-
-                                v = edge_visible[b][c] |= INVISIBLE;
-                                edge_visible[c][b] |= INVISIBLE;
-
-                                w = edge_visible[c][a] |= INVISIBLE;
-                                edge_visible[a][c] |= INVISIBLE;
-                        }
-
-                        if (u == BOTH)
-                        {
-                                to_add[num_to_add][0] = i;
-                                to_add[num_to_add][1] = a;
-                                to_add[num_to_add][2] = b;
-                                num_to_add++;
-                        }
-
-                        if (v == BOTH)
-                        {
-                                to_add[num_to_add][0] = i;
-                                to_add[num_to_add][1] = b;
-                                to_add[num_to_add][2] = c;
-                                num_to_add++;
-                        }
-
-                        if (w == BOTH)
-                        {
-                                to_add[num_to_add][0] = i;
-                                to_add[num_to_add][1] = c;
-                                to_add[num_to_add][2] = a;
-                                num_to_add++;
+                                int a = f[k];
+                                int b = f[(k + 1) % 3];
+                                if (!((edges_visible[b] >> a) & 1))
+                                {
+                                        to_add[num_to_add][0] = i;
+                                        to_add[num_to_add][1] = a;
+                                        to_add[num_to_add][2] = b;
+                                        num_to_add++;
+                                }
                         }
                 }
 
+                //remove the visible facets, last first, so that each is replaced by an invisible one
+                for (int j = ch->num_facets - 1;j>=0;j--)
+                        if ((visible >> j) & 1)
+                                remove_hull_facet(ch, j);
+
                 for (int j = 0;j<num_to_add;j++)
                 {
                         if (ch->num_facets >= PTM_MAX_FACETS)
                                 return -4;
 
-                        add_facet(points, to_add[j][0], to_add[j][1], to_add[j][2], ch->facets[ch->num_facets], ch->plane_normal[ch->num_facets], ch->barycentre); ch->num_facets++;
+                        add_hull_facet(points, to_add[j][0], to_add[j][1], to_add[j][2], ch);
                 }
         }
 
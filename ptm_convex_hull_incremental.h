@@ -20,7 +20,11 @@ namespace ptm {
 typedef struct
 {
         int8_t facets[PTM_MAX_FACETS][3];
-        double plane_normal[PTM_MAX_FACETS][3];
+
+        //facet planes, stored as structure of arrays so that a point is tested against all facets
+        //in one vectorizable loop: facet j has normal normal[.][j] and contains plane_point[.][j]
+        double normal[3][PTM_MAX_FACETS];
+        double plane_point[3][PTM_MAX_FACETS];
         bool processed[PTM_MAX_POINTS];
         int initial_vertices[4];
         double barycentre[3];
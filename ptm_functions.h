@@ -16,27 +16,118 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include "ptm_constants.h"
 
 
-//------------------------------------
-//    function declarations
-//------------------------------------
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+//------------------------------------
+//    batch input and output
+//------------------------------------
+typedef struct
+{
+	size_t num_atoms;
+	const double (*positions)[3];
+	const int32_t* numbers;		//atomic numbers, NULL if not used
+	const double* cell;		//periodic cell vectors as rows of a 3x3 matrix, NULL if not periodic; each atom
+					//is a neighbour at most once, at its nearest image, so the cell must be wider
+					//than twice the distance to the farthest neighbour used
+	bool pbc[3];			//periodicity along each cell vector
+	int max_nbrs;			//row length of the neighbour table
+	const int32_t* nbrs;		//neighbour table, rows sorted by distance and padded with -1; NULL to search for neighbours
+} ptm_system_t;
+
+typedef struct
+{
+	int32_t mask;			//PTM_OUTPUT_* flags, one per column; only these columns are computed and written
+	int32_t* type;			//always written; unmatched rows have PTM_MATCH_NONE, an infinite RMSD,
+					//output indices of -1 and zeros in the other columns
+	int32_t* alloy_type;
+	double* scale;
+	double* rmsd;
+	double (*q)[4];
+	double (*F)[9];
+	double (*F_res)[3];
+	double (*U)[9];
+	double (*P)[9];
+	double* interatomic_distance;
+	double* lattice_constant;
+	int* best_template_index;
+	int8_t (*output_indices)[PTM_MAX_INPUT_POINTS];
+} ptm_output_t;
+
+//------------------------------------
+//    statistics
+//------------------------------------
+typedef struct
+{
+	uint64_t num_atoms;				//atoms indexed
+	uint64_t num_matched;				//atoms assigned a structure
+	uint64_t num_reused;				//matched atoms which kept the mapping of a warm start
+	uint64_t calls[PTM_NUM_STAGES];			//indexed by PTM_STAGE_*
+	double seconds[PTM_NUM_STAGES];
+	uint64_t rejected[PTM_NUM_REJECTIONS];		//indexed by PTM_REJECT_*, counted once per structure group tried
+} ptm_stats_t;
+
+
+//------------------------------------
+//    warm start
+//------------------------------------
+//Matches kept between calls of ptm_index_many or ptm_index_many_threaded on consecutive frames of the
+//same atoms.  An atom whose matched neighbours are unchanged keeps its previous mapping, without the
+//convex hull and graph matching, if that mapping still has an RMSD below guard_rmsd; otherwise it is
+//matched in full.  The stored matches are discarded when the number of atoms changes.
+typedef struct ptm_warm_start* ptm_warm_start_t;
+
+
+//------------------------------------
+//    function declarations
+//------------------------------------
+
 
 int ptm_index(	ptm_local_handle_t local_handle,
 		size_t atom_index, int (get_neighbours)(void* vdata, size_t _unused_lammps_variable, size_t atom_index, int num, int* ordering, size_t* nbr_indices, int32_t* numbers, double (*nbr_pos)[3]), void* nbrlist,
-		int32_t flags, bool output_conventional_orientation, //inputs
+		int32_t flags, bool output_conventional_orientation, double max_rmsd, //inputs
 		int32_t* p_type, int32_t* p_alloy_type, double* p_scale, double* p_rmsd, double* q, double* F, double* F_res, double* U, double* P, double* p_interatomic_distance, double* p_lattice_constant,
 		int* p_best_template_index, const double (**p_best_template)[3], int8_t* output_indices);	//outputs
 
 
+int ptm_index_many(	ptm_local_handle_t local_handle, const ptm_system_t* system,
+			int32_t flags, bool output_conventional_orientation, double max_rmsd,	//inputs
+			ptm_warm_start_t warm_start,						//NULL to match every atom in full
+			ptm_output_t* output);							//outputs
+
+int ptm_index_many_threaded(	const ptm_system_t* system,
+				int32_t flags, bool output_conventional_orientation, double max_rmsd, int num_threads,	//inputs
+				ptm_warm_start_t warm_start,								//NULL to match every atom in full
+				ptm_output_t* output, ptm_stats_t* thread_stats);				//outputs; thread_stats has num_threads entries, or is NULL
+
+ptm_warm_start_t ptm_initialize_warm_start(double guard_rmsd);
+void ptm_uninitialize_warm_start(ptm_warm_start_t warm_start);
+
+int ptm_build_neighbour_table(	const ptm_system_t* system, int max_nbrs, int num_threads,	//inputs
+				int32_t* nbrs);							//outputs
+
+//Orders the neighbours of every atom by the solid angle of their Voronoi faces, as ptm_preorder_neighbours
+//does for a single atom.  The candidates are the first PTM_MAX_INPUT_POINTS - 1 neighbours in the table of
+//the system (found by the cell-list search if it has none).  The output has the layout of
+//ptm_build_neighbour_table, can be used as the neighbour table of ptm_index_many, and must not alias
+//the input table.
+int ptm_preorder_neighbour_table(	const ptm_system_t* system, int max_nbrs, int num_threads,	//inputs
+					int32_t* nbrs);							//outputs
+
+
+//Statistics are gathered per local handle, and only if the library is compiled with PTM_ENABLE_STATS.
+//Otherwise ptm_get_stats zeroes stats and returns -1.
+int ptm_get_stats(ptm_local_handle_t local_handle, ptm_stats_t* stats);
+void ptm_reset_stats(ptm_local_handle_t local_handle);
+
+
 int ptm_remap_template(	int type, bool output_conventional_orientation, int input_template_index, double* qtarget, double* q,
 			double* p_disorientation, int8_t* mapping, const double (**p_best_template)[3]);
 
 int ptm_undo_conventional_orientation(int type, int input_template_index, double* q, int8_t* mapping);
 
-int ptm_preorder_neighbours(void* _voronoi_handle, int num_input_points, double (*input_points)[3], uint64_t* res);
+int ptm_preorder_neighbours(ptm_local_handle_t local_handle, int num_input_points, double (*input_points)[3], uint64_t* res);
 void ptm_index_to_permutation(int n, uint64_t k, int* permuted);
 
 
@@ -7,12 +7,14 @@ The above copyright notice and this permission notice shall be included in all c
 THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 */
 
+//generated by datagen/generate_graph_data from datagen/dumped_data.txt, do not edit
+
 #include "ptm_graph_data.h"
 
 
 namespace ptm {
 
-int8_t automorphisms[65][17] = {
+const int8_t automorphisms[65][17] = {
         {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15, 16},
         {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, -1, -1, -1, -1},
         {  0,  1, 11,  7,  4,  8, 10, 12,  6,  5,  9,  3,  2, -1, -1, -1, -1},
@@ -80,1991 +82,1991 @@ int8_t automorphisms[65][17] = {
         {  0,  3,  4,  1,  2, 13, 12, 11, 16, 15, 14,  7,  6,  5, 10,  9,  8},
 };
 
-graph_t graphs_sc[NUM_SC_GRAPHS] = {
+const graph_t graphs_sc[NUM_SC_GRAPHS] = {
 
 {0,
-0,
+UINT64_C(0xc7a846142e0eb142),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0},
-{{1,3,4},{1,3,5},{0,3,4},{0,3,5},{1,2,5},{1,2,4},{0,2,4},{0,2,5}}},
+{0, 4, 2, 6, 1, 3, 5},
+{{3,1,4},{1,3,5},{0,3,4},{3,0,5},{2,1,5},{1,2,4},{2,0,4},{0,2,5}}},
 
 };
 
-graph_t graphs_ico[NUM_ICO_GRAPHS] = {
+const graph_t graphs_ico[NUM_ICO_GRAPHS] = {
 
 {0,
-0,
+UINT64_C(0xe04340a252212c6b),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,5,7},{0,5,9},{2,5,7},{1,4,6},{1,6,10},{5,9,10},{6,9,10},{2,5,10},{1,2,10},{0,7,11},{3,6,9},{0,3,9},{3,4,6},{0,3,11},{3,4,11},{1,2,8},{2,7,8},{1,4,8},{4,8,11},{7,8,11}}},
+{0, 2, 10, 4, 7, 12, 1, 11, 3, 9, 6, 5, 8},
+{{5,0,7},{0,5,9},{2,5,7},{1,4,6},{1,6,10},{9,5,10},{6,9,10},{5,2,10},{2,1,10},{7,0,11},{6,3,9},{3,0,9},{4,3,6},{0,3,11},{3,4,11},{1,2,8},{2,7,8},{4,1,8},{4,8,11},{8,7,11}}},
 
 };
 
-graph_t graphs_fcc[NUM_FCC_GRAPHS] = {
+const graph_t graphs_fcc[NUM_FCC_GRAPHS] = {
 
 {0,
-0,
+UINT64_C(0x1c4ee83dce844ae6),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,1,2},{3,4,5},{5,6,10},{3,7,8},{1,6,8},{0,10,11},{2,7,9},{4,9,11},{0,6,10},{0,1,6},{1,7,8},{1,2,7},{3,6,8},{3,5,6},{4,10,11},{4,5,10},{4,7,9},{3,4,7},{2,9,11},{0,2,11}}},
+{0, 12, 5, 6, 3, 2, 10, 11, 1, 4, 7, 9, 8},
+{{1,0,2},{3,4,5},{6,5,10},{7,3,8},{6,1,8},{0,10,11},{7,2,9},{4,9,11},{0,6,10},{0,1,6},{1,7,8},{1,2,7},{3,6,8},{3,5,6},{10,4,11},{5,4,10},{4,7,9},{4,3,7},{9,2,11},{2,0,11}}},
 
 {1,
-0,
+UINT64_C(0xc249e93dce812cd6),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,1,2},{3,4,5},{5,6,10},{3,7,8},{1,6,8},{0,10,11},{2,7,9},{4,9,11},{0,6,10},{0,1,6},{1,7,8},{1,2,7},{3,6,8},{3,5,6},{4,10,11},{4,5,10},{4,7,9},{3,4,7},{0,9,11},{0,2,9}}},
+{0, 1, 7, 6, 9, 11, 10, 2, 12, 8, 5, 3, 4},
+{{1,0,2},{3,4,5},{6,5,10},{7,3,8},{6,1,8},{0,10,11},{7,2,9},{4,9,11},{0,6,10},{0,1,6},{1,7,8},{1,2,7},{3,6,8},{3,5,6},{10,4,11},{5,4,10},{4,7,9},{4,3,7},{9,0,11},{2,0,9}}},
 
 {2,
-0,
+UINT64_C(0x854ee83dce844ae6),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,1,2},{3,4,5},{5,6,10},{3,7,8},{1,6,8},{0,10,11},{2,7,9},{4,9,11},{0,6,10},{0,1,6},{1,7,8},{1,2,7},{3,6,8},{3,5,6},{4,10,11},{4,5,10},{3,7,9},{3,4,9},{2,9,11},{0,2,11}}},
+{0, 9, 10, 11, 1, 6, 7, 2, 4, 3, 5, 8, 12},
+{{1,0,2},{3,4,5},{6,5,10},{7,3,8},{6,1,8},{0,10,11},{7,2,9},{4,9,11},{0,6,10},{0,1,6},{1,7,8},{1,2,7},{3,6,8},{3,5,6},{10,4,11},{5,4,10},{3,7,9},{4,3,9},{9,2,11},{2,0,11}}},
 
 {3,
-0,
+UINT64_C(0xc74aeba0e451098a),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,1,2},{3,4,5},{5,6,10},{3,7,8},{1,6,8},{0,10,11},{2,7,9},{4,9,11},{0,6,10},{0,1,6},{1,7,8},{1,2,7},{3,6,8},{3,5,6},{4,10,11},{4,5,10},{3,7,9},{3,4,9},{0,9,11},{0,2,9}}},
+{0, 1, 7, 6, 9, 11, 10, 2, 12, 8, 5, 3, 4},
+{{1,0,2},{3,4,5},{6,5,10},{7,3,8},{6,1,8},{0,10,11},{7,2,9},{4,9,11},{0,6,10},{0,1,6},{1,7,8},{1,2,7},{3,6,8},{3,5,6},{10,4,11},{5,4,10},{3,7,9},{4,3,9},{9,0,11},{2,0,9}}},
 
 {4,
-0,
+UINT64_C(0x5a4ee1a204244a08),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,1,2},{3,4,5},{5,6,10},{3,7,8},{1,6,8},{0,10,11},{2,7,9},{4,9,11},{0,6,10},{0,1,6},{1,7,8},{1,2,7},{3,6,8},{3,5,6},{5,10,11},{4,5,11},{4,7,9},{3,4,7},{2,9,11},{0,2,11}}},
+{0, 2, 3, 9, 5, 11, 6, 1, 10, 4, 12, 7, 8},
+{{1,0,2},{3,4,5},{6,5,10},{7,3,8},{6,1,8},{0,10,11},{7,2,9},{4,9,11},{0,6,10},{0,1,6},{1,7,8},{1,2,7},{3,6,8},{3,5,6},{10,5,11},{5,4,11},{4,7,9},{4,3,7},{9,2,11},{2,0,11}}},
 
 {5,
-0,
+UINT64_C(0xc74aeba0e4544a8b),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,1,2},{3,4,5},{5,6,10},{3,7,8},{1,6,8},{0,10,11},{2,7,9},{4,9,11},{0,6,10},{0,1,6},{1,7,8},{1,2,7},{3,6,8},{3,5,6},{5,10,11},{4,5,11},{3,7,9},{3,4,9},{0,9,11},{0,2,9}}},
+{0, 2, 3, 10, 5, 12, 6, 1, 11, 4, 9, 7, 8},
+{{1,0,2},{3,4,5},{6,5,10},{7,3,8},{6,1,8},{0,10,11},{7,2,9},{4,9,11},{0,6,10},{0,1,6},{1,7,8},{1,2,7},{3,6,8},{3,5,6},{10,5,11},{5,4,11},{3,7,9},{4,3,9},{9,0,11},{2,0,9}}},
 
 {6,
-0,
+UINT64_C(0xe04340a252212c6b),
 1,
 5,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,1,2},{3,4,5},{5,6,10},{3,7,8},{1,6,8},{0,10,11},{2,7,9},{4,9,11},{0,6,10},{0,1,6},{1,7,8},{1,2,7},{5,6,8},{3,5,8},{4,10,11},{4,5,10},{3,7,9},{3,4,9},{2,9,11},{0,2,11}}},
+{0, 2, 1, 3, 10, 12, 11, 6, 4, 5, 9, 7, 8},
+{{1,0,2},{3,4,5},{6,5,10},{7,3,8},{6,1,8},{0,10,11},{7,2,9},{4,9,11},{0,6,10},{0,1,6},{1,7,8},{1,2,7},{5,6,8},{3,5,8},{10,4,11},{5,4,10},{3,7,9},{4,3,9},{9,2,11},{2,0,11}}},
 
 {7,
-0,
+UINT64_C(0x5a4ee1a204244a08),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,1,2},{3,4,5},{5,6,10},{3,7,8},{1,6,8},{0,10,11},{2,7,9},{4,9,11},{0,6,10},{0,1,6},{1,7,8},{1,2,7},{5,6,8},{3,5,8},{5,10,11},{4,5,11},{4,7,9},{3,4,7},{0,9,11},{0,2,9}}},
+{0, 1, 2, 7, 12, 11, 10, 3, 8, 9, 6, 4, 5},
+{{1,0,2},{3,4,5},{6,5,10},{7,3,8},{6,1,8},{0,10,11},{7,2,9},{4,9,11},{0,6,10},{0,1,6},{1,7,8},{1,2,7},{5,6,8},{3,5,8},{10,5,11},{5,4,11},{4,7,9},{4,3,7},{9,0,11},{2,0,9}}},
 
 };
 
-graph_t graphs_hcp[NUM_HCP_GRAPHS] = {
+const graph_t graphs_hcp[NUM_HCP_GRAPHS] = {
 
 {0,
-0,
+UINT64_C(0xec4feb3fce8446c4),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,2,5},{1,5,11},{3,6,7},{2,3,4},{9,10,11},{6,7,10},{0,4,8},{0,8,9},{3,5,6},{2,3,5},{6,10,11},{5,6,11},{1,9,11},{1,8,9},{1,4,8},{1,2,4},{7,9,10},{0,7,9},{3,4,7},{0,4,7}}},
+{0, 6, 2, 9, 12, 8, 10, 11, 5, 7, 1, 4, 3},
+{{1,2,5},{1,5,11},{6,3,7},{3,2,4},{10,9,11},{6,7,10},{0,4,8},{0,8,9},{5,3,6},{2,3,5},{6,10,11},{5,6,11},{9,1,11},{8,1,9},{4,1,8},{2,1,4},{7,9,10},{7,0,9},{3,4,7},{4,0,7}}},
 
 {1,
-0,
+UINT64_C(0xc34ee83dce844ae6),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,2,5},{1,5,11},{3,6,7},{2,3,4},{9,10,11},{6,7,10},{0,4,8},{0,8,9},{3,5,6},{2,3,5},{6,10,11},{5,6,11},{1,9,11},{1,8,9},{1,4,8},{1,2,4},{7,9,10},{0,7,9},{0,3,7},{0,3,4}}},
+{0, 6, 2, 9, 12, 8, 10, 11, 5, 7, 1, 4, 3},
+{{1,2,5},{1,5,11},{6,3,7},{3,2,4},{10,9,11},{6,7,10},{0,4,8},{0,8,9},{5,3,6},{2,3,5},{6,10,11},{5,6,11},{9,1,11},{8,1,9},{4,1,8},{2,1,4},{7,9,10},{7,0,9},{3,0,7},{0,3,4}}},
 
 {2,
-0,
+UINT64_C(0x854ee83dce844ae6),
 6,
 2,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,2,5},{1,5,11},{3,6,7},{2,3,4},{9,10,11},{6,7,10},{0,4,8},{0,8,9},{3,5,6},{2,3,5},{6,10,11},{5,6,11},{1,9,11},{1,8,9},{1,4,8},{1,2,4},{0,9,10},{0,7,10},{3,4,7},{0,4,7}}},
+{0, 4, 2, 7, 6, 1, 8, 12, 5, 3, 10, 11, 9},
+{{1,2,5},{1,5,11},{6,3,7},{3,2,4},{10,9,11},{6,7,10},{0,4,8},{0,8,9},{5,3,6},{2,3,5},{6,10,11},{5,6,11},{9,1,11},{8,1,9},{4,1,8},{2,1,4},{0,9,10},{7,0,10},{3,4,7},{4,0,7}}},
 
 {3,
-0,
+UINT64_C(0x1c4ee83dce844ae6),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,2,5},{1,5,11},{3,6,7},{2,3,4},{9,10,11},{6,7,10},{0,4,8},{0,8,9},{3,5,6},{2,3,5},{6,10,11},{5,6,11},{1,9,11},{1,8,9},{1,4,8},{1,2,4},{0,9,10},{0,7,10},{0,3,7},{0,3,4}}},
+{0, 1, 11, 10, 2, 3, 9, 8, 7, 4, 5, 6, 12},
+{{1,2,5},{1,5,11},{6,3,7},{3,2,4},{10,9,11},{6,7,10},{0,4,8},{0,8,9},{5,3,6},{2,3,5},{6,10,11},{5,6,11},{9,1,11},{8,1,9},{4,1,8},{2,1,4},{0,9,10},{7,0,10},{3,0,7},{0,3,4}}},
 
 {4,
-0,
+UINT64_C(0x9549e0adc4212c38),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,2,5},{1,5,11},{3,6,7},{2,3,4},{9,10,11},{6,7,10},{0,4,8},{0,8,9},{3,5,6},{2,3,5},{6,10,11},{5,6,11},{1,9,11},{1,8,9},{2,4,8},{1,2,8},{7,9,10},{0,7,9},{0,3,7},{0,3,4}}},
+{0, 5, 9, 3, 1, 4, 2, 7, 6, 10, 11, 12, 8},
+{{1,2,5},{1,5,11},{6,3,7},{3,2,4},{10,9,11},{6,7,10},{0,4,8},{0,8,9},{5,3,6},{2,3,5},{6,10,11},{5,6,11},{9,1,11},{8,1,9},{4,2,8},{2,1,8},{7,9,10},{7,0,9},{3,0,7},{0,3,4}}},
 
 {5,
-0,
+UINT64_C(0xe04340a252212c6b),
 8,
 10,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,2,5},{1,5,11},{3,6,7},{2,3,4},{9,10,11},{6,7,10},{0,4,8},{0,8,9},{3,5,6},{2,3,5},{6,10,11},{5,6,11},{1,9,11},{1,8,9},{2,4,8},{1,2,8},{0,9,10},{0,7,10},{3,4,7},{0,4,7}}},
+{0, 11, 1, 2, 8, 7, 3, 9, 12, 6, 5, 10, 4},
+{{1,2,5},{1,5,11},{6,3,7},{3,2,4},{10,9,11},{6,7,10},{0,4,8},{0,8,9},{5,3,6},{2,3,5},{6,10,11},{5,6,11},{9,1,11},{8,1,9},{4,2,8},{2,1,8},{0,9,10},{7,0,10},{3,4,7},{4,0,7}}},
 
 {6,
-0,
+UINT64_C(0x5b49e0adc4212c38),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,2,5},{1,5,11},{3,6,7},{2,3,4},{9,10,11},{6,7,10},{0,4,8},{0,8,9},{3,5,6},{2,3,5},{6,10,11},{5,6,11},{8,9,11},{1,8,11},{1,4,8},{1,2,4},{7,9,10},{0,7,9},{0,3,7},{0,3,4}}},
+{0, 6, 10, 4, 1, 5, 3, 2, 7, 11, 12, 8, 9},
+{{1,2,5},{1,5,11},{6,3,7},{3,2,4},{10,9,11},{6,7,10},{0,4,8},{0,8,9},{5,3,6},{2,3,5},{6,10,11},{5,6,11},{9,8,11},{8,1,11},{4,1,8},{2,1,4},{7,9,10},{7,0,9},{3,0,7},{0,3,4}}},
 
 {7,
-0,
+UINT64_C(0x1c4ee83dce8ddae6),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,2,5},{1,5,11},{3,6,7},{2,3,4},{9,10,11},{6,7,10},{0,4,8},{0,8,9},{3,5,6},{2,3,5},{6,10,11},{5,6,11},{8,9,11},{1,8,11},{1,4,8},{1,2,4},{0,9,10},{0,7,10},{0,3,7},{0,3,4}}},
+{0, 1, 11, 10, 2, 3, 9, 8, 7, 4, 5, 6, 12},
+{{1,2,5},{1,5,11},{6,3,7},{3,2,4},{10,9,11},{6,7,10},{0,4,8},{0,8,9},{5,3,6},{2,3,5},{6,10,11},{5,6,11},{9,8,11},{8,1,11},{4,1,8},{2,1,4},{0,9,10},{7,0,10},{3,0,7},{0,3,4}}},
 
 {8,
-0,
+UINT64_C(0x5a4ee83dc4244ae6),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,2,5},{1,5,11},{3,6,7},{2,3,4},{9,10,11},{6,7,10},{0,4,8},{0,8,9},{3,5,6},{2,3,5},{6,10,11},{5,6,11},{8,9,11},{1,8,11},{2,4,8},{1,2,8},{0,9,10},{0,7,10},{0,3,7},{0,3,4}}},
+{0, 2, 5, 4, 10, 3, 11, 12, 9, 1, 7, 8, 6},
+{{1,2,5},{1,5,11},{6,3,7},{3,2,4},{10,9,11},{6,7,10},{0,4,8},{0,8,9},{5,3,6},{2,3,5},{6,10,11},{5,6,11},{9,8,11},{8,1,11},{4,2,8},{2,1,8},{0,9,10},{7,0,10},{3,0,7},{0,3,4}}},
 
 {9,
-0,
+UINT64_C(0xec9ceb3dce844a24),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,2,5},{1,5,11},{3,6,7},{2,3,4},{9,10,11},{6,7,10},{0,4,8},{0,8,9},{3,5,6},{2,3,5},{5,10,11},{5,6,10},{1,9,11},{1,8,9},{1,4,8},{1,2,4},{7,9,10},{0,7,9},{3,4,7},{0,4,7}}},
+{0, 7, 9, 12, 5, 6, 11, 4, 1, 8, 2, 3, 10},
+{{1,2,5},{1,5,11},{6,3,7},{3,2,4},{10,9,11},{6,7,10},{0,4,8},{0,8,9},{5,3,6},{2,3,5},{5,10,11},{5,6,10},{9,1,11},{8,1,9},{4,1,8},{2,1,4},{7,9,10},{7,0,9},{3,4,7},{4,0,7}}},
 
 {10,
-0,
+UINT64_C(0x854ee83dc4244ae6),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,2,5},{1,5,11},{3,6,7},{2,3,4},{9,10,11},{6,7,10},{0,4,8},{0,8,9},{3,5,6},{2,3,5},{5,10,11},{5,6,10},{1,9,11},{1,8,9},{1,4,8},{1,2,4},{7,9,10},{0,7,9},{0,3,7},{0,3,4}}},
+{0, 9, 6, 7, 2, 8, 1, 3, 10, 12, 11, 4, 5},
+{{1,2,5},{1,5,11},{6,3,7},{3,2,4},{10,9,11},{6,7,10},{0,4,8},{0,8,9},{5,3,6},{2,3,5},{5,10,11},{5,6,10},{9,1,11},{8,1,9},{4,1,8},{2,1,4},{7,9,10},{7,0,9},{3,0,7},{0,3,4}}},
 
 {11,
-0,
+UINT64_C(0x1c4ee83dce844ae6),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,2,5},{1,5,11},{3,6,7},{2,3,4},{9,10,11},{6,7,10},{0,4,8},{0,8,9},{3,5,6},{2,3,5},{5,10,11},{5,6,10},{8,9,11},{1,8,11},{1,4,8},{1,2,4},{7,9,10},{0,7,9},{3,4,7},{0,4,7}}},
+{0, 7, 5, 4, 3, 1, 11, 10, 2, 6, 8, 9, 12},
+{{1,2,5},{1,5,11},{6,3,7},{3,2,4},{10,9,11},{6,7,10},{0,4,8},{0,8,9},{5,3,6},{2,3,5},{5,10,11},{5,6,10},{9,8,11},{8,1,11},{4,1,8},{2,1,4},{7,9,10},{7,0,9},{3,4,7},{4,0,7}}},
 
 {12,
-0,
+UINT64_C(0x854ee83dce844ae6),
 18,
 2,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,2,5},{1,5,11},{3,6,7},{2,3,4},{9,10,11},{6,7,10},{0,4,8},{0,8,9},{3,5,6},{2,3,5},{5,10,11},{5,6,10},{8,9,11},{1,8,11},{1,4,8},{1,2,4},{7,9,10},{0,7,9},{0,3,7},{0,3,4}}},
+{0, 9, 6, 7, 2, 8, 1, 3, 10, 12, 11, 4, 5},
+{{1,2,5},{1,5,11},{6,3,7},{3,2,4},{10,9,11},{6,7,10},{0,4,8},{0,8,9},{5,3,6},{2,3,5},{5,10,11},{5,6,10},{9,8,11},{8,1,11},{4,1,8},{2,1,4},{7,9,10},{7,0,9},{3,0,7},{0,3,4}}},
 
 {13,
-0,
+UINT64_C(0xec9ceb3dce8dda24),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,2,5},{1,5,11},{3,6,7},{2,3,4},{9,10,11},{6,7,10},{0,4,8},{0,8,9},{3,5,6},{2,3,5},{5,10,11},{5,6,10},{8,9,11},{1,8,11},{1,4,8},{1,2,4},{0,9,10},{0,7,10},{0,3,7},{0,3,4}}},
+{0, 9, 4, 5, 6, 12, 1, 7, 8, 11, 10, 2, 3},
+{{1,2,5},{1,5,11},{6,3,7},{3,2,4},{10,9,11},{6,7,10},{0,4,8},{0,8,9},{5,3,6},{2,3,5},{5,10,11},{5,6,10},{9,8,11},{8,1,11},{4,1,8},{2,1,4},{0,9,10},{7,0,10},{3,0,7},{0,3,4}}},
 
 {14,
-0,
+UINT64_C(0x5a4ee1a204244a08),
 20,
 2,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,2,5},{1,5,11},{3,6,7},{2,3,4},{9,10,11},{6,7,10},{0,4,8},{0,8,9},{3,5,6},{2,3,5},{5,10,11},{5,6,10},{8,9,11},{1,8,11},{2,4,8},{1,2,8},{7,9,10},{0,7,9},{3,4,7},{0,4,7}}},
+{0, 12, 7, 2, 3, 9, 1, 4, 10, 8, 11, 5, 6},
+{{1,2,5},{1,5,11},{6,3,7},{3,2,4},{10,9,11},{6,7,10},{0,4,8},{0,8,9},{5,3,6},{2,3,5},{5,10,11},{5,6,10},{9,8,11},{8,1,11},{4,2,8},{2,1,8},{7,9,10},{7,0,9},{3,4,7},{4,0,7}}},
 
 {15,
-0,
+UINT64_C(0xe04340a252212c6b),
 22,
 10,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,2,5},{1,5,11},{3,6,7},{2,3,4},{9,10,11},{6,7,10},{0,4,8},{0,8,9},{2,5,6},{2,3,6},{5,10,11},{5,6,10},{8,9,11},{1,8,11},{1,4,8},{1,2,4},{7,9,10},{0,7,9},{0,3,7},{0,3,4}}},
+{0, 11, 1, 2, 7, 6, 3, 8, 12, 5, 10, 9, 4},
+{{1,2,5},{1,5,11},{6,3,7},{3,2,4},{10,9,11},{6,7,10},{0,4,8},{0,8,9},{5,2,6},{2,3,6},{5,10,11},{5,6,10},{9,8,11},{8,1,11},{4,1,8},{2,1,4},{7,9,10},{7,0,9},{3,0,7},{0,3,4}}},
 
 };
 
-graph_t graphs_bcc[NUM_BCC_GRAPHS] = {
+const graph_t graphs_bcc[NUM_BCC_GRAPHS] = {
 
 {0,
-0,
+UINT64_C(0xbda0e098a21132c1),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{6,9,11},{3,9,11},{7,8,13},{2,8,13},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,9,11},{9,3,11},{7,8,13},{8,2,13},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {1,
-0,
+UINT64_C(0x4a94929252716acd),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{6,9,11},{3,9,11},{7,8,13},{2,8,13},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 9, 10, 3, 14, 7, 12, 13, 5, 1, 11, 2, 6, 8, 4},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,9,11},{9,3,11},{7,8,13},{8,2,13},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {2,
-0,
+UINT64_C(0x4a949293f1fbba9d),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{6,9,11},{3,9,11},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 3, 9, 12, 7, 5, 10, 14, 13, 4, 8, 2, 6, 1, 11},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,9,11},{9,3,11},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {3,
-0,
+UINT64_C(0xeda495c5fefbb591),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {4,
-0,
+UINT64_C(0x4ea294a262716acd),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 3, 9, 12, 7, 5, 10, 14, 13, 4, 8, 2, 6, 1, 11},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {5,
-0,
+UINT64_C(0x4ea295c5fcfaba9d),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 3, 9, 12, 7, 5, 10, 14, 13, 4, 8, 2, 6, 1, 11},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {6,
-0,
+UINT64_C(0xbe1a0bf2726132c1),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {7,
-0,
+UINT64_C(0x7ca50bf4a1c162f9),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {8,
-0,
+UINT64_C(0xbc2b0cc242716aca),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 3, 9, 12, 7, 5, 10, 14, 13, 4, 8, 2, 6, 1, 11},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {9,
-0,
+UINT64_C(0x4f2b0e95a221120c),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 3, 9, 12, 7, 5, 10, 14, 13, 4, 8, 2, 6, 1, 11},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {10,
-0,
+UINT64_C(0x4a94948252716acd),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {11,
-0,
+UINT64_C(0x4a9495c5fefbba9d),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {12,
-0,
+UINT64_C(0x4ea884a262716acd),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {13,
-0,
+UINT64_C(0x4ea947c6fcfaba9d),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {14,
-0,
+UINT64_C(0xbc211cc242716aca),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {15,
-0,
+UINT64_C(0x4f2f2f928231120c),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {16,
-0,
+UINT64_C(0x901b79fc52d1fad9),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 9, 3, 7, 11, 10, 5, 12, 13, 8, 4, 1, 14, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {17,
-0,
+UINT64_C(0x4a842ecd4e06599d),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 5, 7, 3, 14, 13, 9, 10, 12, 4, 8, 1, 11, 6, 2},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {18,
-0,
+UINT64_C(0x4b1d052d2ec1eafc),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 7, 9, 5, 10, 14, 3, 11, 12, 6, 2, 1, 13, 8, 4},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {19,
-0,
+UINT64_C(0x4b1d0d9d32dc91fc),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 5, 7, 3, 14, 13, 9, 10, 12, 4, 8, 1, 11, 6, 2},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {20,
-0,
+UINT64_C(0xb51d052a3221eaa8),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 7, 9, 5, 10, 13, 3, 11, 12, 6, 2, 1, 14, 8, 4},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {21,
-0,
+UINT64_C(0x3eb83faac2d48dfe),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 7, 9, 5, 10, 14, 3, 12, 13, 6, 2, 1, 11, 8, 4},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {22,
-0,
+UINT64_C(0xb7201fcac2d48e48),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 7, 9, 5, 10, 14, 3, 12, 13, 6, 2, 1, 11, 8, 4},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {23,
-0,
+UINT64_C(0x3eb9fcce4c045dfe),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 7, 9, 5, 10, 14, 3, 12, 13, 6, 2, 1, 11, 8, 4},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {24,
-0,
+UINT64_C(0xb72e2c9a12ccfcff),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 7, 9, 5, 10, 14, 3, 12, 13, 6, 2, 1, 11, 8, 4},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {25,
-0,
+UINT64_C(0x4f2f242e2cc18a0c),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 9, 3, 7, 11, 10, 5, 12, 14, 8, 4, 1, 13, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {26,
-0,
+UINT64_C(0xb02f273a02318aa6),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 9, 3, 7, 11, 10, 5, 12, 13, 8, 4, 1, 14, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {27,
-0,
+UINT64_C(0x4f2f242e22318a0c),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 9, 3, 7, 11, 10, 5, 12, 14, 8, 4, 1, 13, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {28,
-0,
+UINT64_C(0xb02f273a0231dea6),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 9, 3, 7, 11, 10, 5, 12, 13, 8, 4, 1, 14, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {29,
-0,
+UINT64_C(0x4eb22faad28c89cd),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {30,
-0,
+UINT64_C(0x4eb22ecd4c07599d),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {31,
-0,
+UINT64_C(0x4eb83faad28c89cd),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {32,
-0,
+UINT64_C(0x4eb9fcce4c07599d),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {33,
-0,
+UINT64_C(0x4f2b0d9d32dcf10c),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {34,
-0,
+UINT64_C(0xbc211fcad28c89ca),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {35,
-0,
+UINT64_C(0x4f2f2c9a12ccf10c),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {36,
-0,
+UINT64_C(0xccb85f5ac2d48df2),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {37,
-0,
+UINT64_C(0xccb9fcc04d045df2),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {38,
-0,
+UINT64_C(0xc2a85f5ac2d48df2),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {39,
-0,
+UINT64_C(0xc367fbc04d045df2),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {40,
-0,
+UINT64_C(0x45207f3ac2d48e44),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {41,
-0,
+UINT64_C(0x452e2c9a12ecccf3),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {42,
-0,
+UINT64_C(0x4b307f3ac2d48e44),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {43,
-0,
+UINT64_C(0x49cf2ffa02ecccf3),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {44,
-0,
+UINT64_C(0x7706527a5df412eb),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 7, 9, 5, 10, 14, 3, 12, 13, 6, 2, 1, 11, 8, 4},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {45,
-0,
+UINT64_C(0xfa2f827a302f19e8),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 7, 9, 5, 10, 14, 3, 12, 13, 6, 2, 1, 11, 8, 4},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {46,
-0,
+UINT64_C(0xb02f273a12443ca6),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 9, 3, 7, 11, 10, 5, 12, 13, 8, 4, 1, 14, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {47,
-0,
+UINT64_C(0x7221575a5ff512eb),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 3, 5, 9, 13, 12, 7, 14, 10, 2, 6, 1, 11, 4, 8},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {48,
-0,
+UINT64_C(0x722157395ff512eb),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 3, 5, 9, 13, 12, 7, 14, 10, 2, 6, 1, 11, 4, 8},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {49,
-0,
+UINT64_C(0x493edba04d8cc7f5),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 9, 3, 7, 11, 10, 5, 13, 14, 8, 4, 1, 12, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {50,
-0,
+UINT64_C(0x493e2f8a026455f3),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 9, 3, 7, 11, 10, 5, 13, 14, 8, 4, 1, 12, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {51,
-0,
+UINT64_C(0xfe08875a302f19e6),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 3, 5, 9, 13, 12, 7, 14, 10, 2, 6, 1, 11, 4, 8},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {52,
-0,
+UINT64_C(0xfe08871c00f11ee6),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 3, 5, 9, 13, 12, 7, 14, 10, 2, 6, 1, 11, 4, 8},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {53,
-0,
+UINT64_C(0x49c8531a026455f3),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 9, 3, 7, 11, 10, 5, 12, 14, 8, 4, 1, 13, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {54,
-0,
+UINT64_C(0x49c7477a02b83348),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 9, 3, 7, 11, 10, 5, 12, 13, 8, 4, 1, 14, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {55,
-0,
+UINT64_C(0x6a3c1c814c7cf685),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {56,
-0,
+UINT64_C(0x6a3cbb814c7cf685),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 3, 5, 9, 13, 12, 7, 14, 10, 2, 6, 1, 11, 4, 8},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {57,
-0,
+UINT64_C(0x6a3c4fdb03946582),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {58,
-0,
+UINT64_C(0x73d4c0074e7cf685),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {59,
-0,
+UINT64_C(0x1a04255c4278f309),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 9, 3, 7, 12, 10, 5, 13, 14, 8, 4, 1, 11, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {60,
-0,
+UINT64_C(0x03942592ca78fcc8),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{5,10,13},{2,10,13},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 9, 3, 7, 11, 10, 5, 12, 13, 8, 4, 1, 14, 2, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{10,5,13},{2,10,13},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {61,
-0,
+UINT64_C(0x83fbcf3d4c291754),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 9, 8, 14, 3, 11, 6, 4, 13, 10, 1, 7, 12, 2, 5},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {62,
-0,
+UINT64_C(0x83fbc7bd4c291754),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 9, 8, 14, 3, 11, 6, 4, 13, 10, 1, 7, 12, 2, 5},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {63,
-0,
+UINT64_C(0x0f2e0500305555e3),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 8, 9, 3, 14, 6, 11, 13, 4, 1, 10, 2, 5, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {64,
-0,
+UINT64_C(0x0f2e0d80305555e3),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 8, 9, 3, 14, 6, 11, 13, 4, 1, 10, 2, 5, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {65,
-0,
+UINT64_C(0x0f2e3400305555e3),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 9, 8, 14, 3, 11, 6, 4, 13, 10, 1, 7, 12, 2, 5},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {66,
-0,
+UINT64_C(0x0f2e3c80305555e3),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 9, 8, 14, 3, 11, 6, 4, 13, 10, 1, 7, 12, 2, 5},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {67,
-0,
+UINT64_C(0x2f2e05003055753c),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 6, 8, 4, 9, 14, 3, 11, 13, 5, 2, 1, 10, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {68,
-0,
+UINT64_C(0x2f2e34003055753c),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 6, 8, 4, 9, 14, 3, 11, 13, 5, 2, 1, 10, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {69,
-0,
+UINT64_C(0x2f2e0d803055753c),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 6, 8, 4, 9, 14, 3, 11, 13, 5, 2, 1, 10, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {70,
-0,
+UINT64_C(0x2f2e3c803055753c),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 6, 8, 4, 9, 14, 3, 11, 13, 5, 2, 1, 10, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {71,
-0,
+UINT64_C(0x102f372400df9aa1),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 8, 3, 6, 10, 9, 5, 11, 13, 7, 4, 1, 14, 2, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {72,
-0,
+UINT64_C(0x102f343400df9aa1),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 8, 3, 6, 10, 9, 5, 11, 13, 7, 4, 1, 14, 2, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {73,
-0,
+UINT64_C(0xf3a9dba3411c54e2),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{6,9,11},{3,9,11},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 8, 3, 6, 11, 9, 5, 12, 14, 7, 4, 1, 10, 2, 13},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,9,11},{9,3,11},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {74,
-0,
+UINT64_C(0xf321dba3411c54e2),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{6,9,11},{3,9,11},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 8, 9, 3, 14, 6, 11, 12, 5, 1, 10, 2, 13, 7, 4},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,9,11},{9,3,11},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {75,
-0,
+UINT64_C(0xf3a9dba34115c4e2),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 8, 3, 6, 11, 9, 5, 12, 14, 7, 4, 1, 10, 2, 13},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {76,
-0,
+UINT64_C(0xf366dba34115c4e2),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 8, 3, 6, 11, 9, 5, 12, 14, 7, 4, 1, 10, 2, 13},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {77,
-0,
+UINT64_C(0xf3eedba3411c54e2),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 8, 9, 3, 14, 6, 11, 12, 5, 1, 10, 2, 13, 7, 4},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {78,
-0,
+UINT64_C(0x493e3b8400ed55e3),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 8, 3, 6, 11, 9, 5, 12, 14, 7, 4, 1, 10, 2, 13},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {79,
-0,
+UINT64_C(0x493e3f9400ed55e3),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 8, 3, 6, 11, 9, 5, 12, 14, 7, 4, 1, 10, 2, 13},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {80,
-0,
+UINT64_C(0xf321dba34115c4e2),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 8, 3, 6, 11, 9, 5, 12, 14, 7, 4, 1, 10, 2, 13},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {81,
-0,
+UINT64_C(0xf3eedba34115c4e2),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 8, 3, 6, 11, 9, 5, 12, 14, 7, 4, 1, 10, 2, 13},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {82,
-0,
+UINT64_C(0x493e371400ed5558),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 8, 3, 6, 11, 9, 5, 12, 14, 7, 4, 1, 10, 2, 13},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {83,
-0,
+UINT64_C(0x493e330400ed55e3),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 8, 3, 6, 11, 9, 5, 12, 14, 7, 4, 1, 10, 2, 13},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {84,
-0,
+UINT64_C(0x493e371400ed55e3),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 8, 3, 6, 11, 9, 5, 12, 14, 7, 4, 1, 10, 2, 13},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {85,
-0,
+UINT64_C(0x12fbcf3d4c291725),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 8, 9, 3, 14, 6, 11, 13, 4, 1, 10, 2, 5, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {86,
-0,
+UINT64_C(0x12fbc7bd4c291725),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 8, 9, 3, 14, 6, 11, 13, 4, 1, 10, 2, 5, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {87,
-0,
+UINT64_C(0xfe5e8729202cf1d9),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 6, 8, 4, 9, 14, 3, 11, 13, 5, 2, 1, 10, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {88,
-0,
+UINT64_C(0xc90ca02c00e1f009),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 11, 3, 9, 4, 13, 8, 6, 14, 10, 1, 2, 5, 12, 7},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {89,
-0,
+UINT64_C(0xc13e3304006555e3),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 8, 9, 3, 14, 6, 11, 13, 4, 1, 10, 2, 5, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {90,
-0,
+UINT64_C(0xc13e3b84006555e3),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 8, 9, 3, 14, 6, 11, 13, 4, 1, 10, 2, 5, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {91,
-0,
+UINT64_C(0xc9c7576400ed3fa0),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 8, 3, 6, 10, 9, 5, 11, 13, 7, 4, 1, 14, 2, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {92,
-0,
+UINT64_C(0xc9c8476400ed3fa0),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 8, 3, 6, 10, 9, 5, 11, 13, 7, 4, 1, 14, 2, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {93,
-0,
+UINT64_C(0x12fbcf3d4c291754),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 8, 9, 3, 14, 6, 11, 13, 4, 1, 10, 2, 5, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {94,
-0,
+UINT64_C(0x12fbc7bd4c291754),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 8, 9, 3, 14, 6, 11, 13, 4, 1, 10, 2, 5, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {95,
-0,
+UINT64_C(0x4e5e8729202cf1d2),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 6, 8, 4, 9, 14, 3, 11, 13, 5, 2, 1, 10, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {96,
-0,
+UINT64_C(0x4e5e872c102cf1d2),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 6, 8, 4, 9, 14, 3, 11, 13, 5, 2, 1, 10, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {97,
-0,
+UINT64_C(0xc1cf3304006555e3),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 8, 9, 3, 14, 6, 11, 13, 4, 1, 10, 2, 5, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {98,
-0,
+UINT64_C(0xc1cf3b84006555e3),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 8, 9, 3, 14, 6, 11, 13, 4, 1, 10, 2, 5, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {99,
-0,
+UINT64_C(0xc9c75764bbed3fa0),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 8, 3, 6, 10, 9, 5, 11, 13, 7, 4, 1, 14, 2, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {100,
-0,
+UINT64_C(0xc9c84764bbed3fa0),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 8, 3, 6, 10, 9, 5, 11, 13, 7, 4, 1, 14, 2, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {101,
-0,
+UINT64_C(0xc1cf3301842d55e3),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 3, 8, 10, 6, 4, 9, 14, 12, 11, 7, 2, 5, 1, 13},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {102,
-0,
+UINT64_C(0x49c02764bbed5558),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 3, 8, 10, 6, 4, 9, 13, 12, 11, 7, 2, 5, 1, 14},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {103,
-0,
+UINT64_C(0x493e3714bbed5558),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 6, 8, 4, 9, 13, 3, 10, 12, 5, 2, 1, 14, 7, 11},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {104,
-0,
+UINT64_C(0x493e371400ed5558),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 3, 8, 10, 6, 4, 9, 13, 12, 11, 7, 2, 5, 1, 14},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {105,
-0,
+UINT64_C(0xc1cf33018bed55e3),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 3, 8, 10, 6, 4, 9, 14, 12, 11, 7, 2, 5, 1, 13},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {106,
-0,
+UINT64_C(0x49c02764bbed3058),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 3, 8, 10, 6, 4, 9, 13, 12, 11, 7, 2, 5, 1, 14},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {107,
-0,
+UINT64_C(0xc1cf330130ed55e3),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 3, 8, 10, 6, 4, 9, 14, 12, 11, 7, 2, 5, 1, 13},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {108,
-0,
+UINT64_C(0x49c0276400ed3058),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 3, 8, 10, 6, 4, 9, 13, 12, 11, 7, 2, 5, 1, 14},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {109,
-0,
+UINT64_C(0xc13e33018bed55e3),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 3, 8, 10, 6, 4, 9, 14, 12, 11, 7, 2, 5, 1, 13},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {110,
-0,
+UINT64_C(0x493e3714bbed3058),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 3, 8, 10, 6, 4, 9, 13, 12, 11, 7, 2, 5, 1, 14},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {111,
-0,
+UINT64_C(0xc13e330130ed55e3),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 3, 8, 10, 6, 4, 9, 14, 12, 11, 7, 2, 5, 1, 13},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {112,
-0,
+UINT64_C(0x493e371400ed3058),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{3,9,12},{1,9,12},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 3, 8, 10, 6, 4, 9, 13, 12, 11, 7, 2, 5, 1, 14},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,9,12},{9,1,12},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {113,
-0,
+UINT64_C(0xfe5f874a203cfbe9),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 8, 10, 3, 14, 7, 12, 13, 5, 1, 11, 2, 6, 9, 4},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {114,
-0,
+UINT64_C(0xc904772c10e2f009),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 8, 10, 3, 14, 7, 12, 13, 5, 1, 11, 2, 6, 9, 4},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {115,
-0,
+UINT64_C(0xc9c02764bbed3050),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 6, 8, 4, 9, 13, 3, 10, 12, 5, 2, 1, 14, 7, 11},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {116,
-0,
+UINT64_C(0xc93e3714bbed3050),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 6, 8, 4, 9, 13, 3, 10, 12, 5, 2, 1, 14, 7, 11},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {117,
-0,
+UINT64_C(0x41cf330130ed55eb),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 6, 8, 4, 9, 14, 3, 10, 12, 5, 2, 1, 13, 7, 11},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {118,
-0,
+UINT64_C(0x413e330130ed55eb),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 6, 8, 4, 9, 14, 3, 10, 12, 5, 2, 1, 13, 7, 11},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {119,
-0,
+UINT64_C(0xc9c0276400ed3050),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 6, 8, 4, 9, 13, 3, 10, 12, 5, 2, 1, 14, 7, 11},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {120,
-0,
+UINT64_C(0xc93e371400ed3050),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 6, 8, 4, 9, 13, 3, 10, 12, 5, 2, 1, 14, 7, 11},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {121,
-0,
+UINT64_C(0xa0d0449d495d3c45),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{6,9,11},{3,9,11},{7,8,13},{2,8,13},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 6, 8, 4, 9, 14, 3, 11, 13, 5, 2, 1, 10, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,9,11},{9,3,11},{7,8,13},{8,2,13},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {122,
-0,
+UINT64_C(0xc908872c982cf109),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{6,9,11},{3,9,11},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 6, 8, 4, 9, 14, 3, 11, 13, 5, 2, 1, 10, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,9,11},{9,3,11},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {123,
-0,
+UINT64_C(0xa0db349d495d3c45),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 11, 3, 9, 4, 13, 8, 6, 14, 10, 1, 2, 5, 12, 7},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {124,
-0,
+UINT64_C(0xc90ca55c88e1f009),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 11, 3, 9, 4, 13, 8, 6, 14, 10, 1, 2, 5, 12, 7},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {125,
-0,
+UINT64_C(0xb97e7cbb132d4582),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 8, 10, 3, 14, 7, 12, 13, 5, 1, 11, 2, 6, 9, 4},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {126,
-0,
+UINT64_C(0x7094250bcae86882),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 6, 8, 4, 9, 13, 3, 10, 12, 5, 2, 1, 14, 7, 11},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {127,
-0,
+UINT64_C(0x7094202ccbe86882),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 6, 8, 4, 9, 13, 3, 10, 12, 5, 2, 1, 14, 7, 11},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {128,
-0,
+UINT64_C(0xd6c8374af2ed4d09),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 3, 5, 8, 12, 11, 7, 13, 9, 2, 6, 1, 10, 4, 14},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {129,
-0,
+UINT64_C(0xd6c8323af2ed4d09),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 3, 5, 8, 12, 11, 7, 13, 9, 2, 6, 1, 10, 4, 14},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {130,
-0,
+UINT64_C(0x7094250bcae1f882),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 6, 8, 4, 9, 13, 3, 10, 12, 5, 2, 1, 14, 7, 11},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {131,
-0,
+UINT64_C(0x7094202ccbe1f882),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 6, 8, 4, 9, 13, 3, 10, 12, 5, 2, 1, 14, 7, 11},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {132,
-0,
+UINT64_C(0x79088729a82cf102),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 6, 8, 4, 9, 14, 3, 11, 13, 5, 2, 1, 10, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {133,
-0,
+UINT64_C(0x7908872c982cf102),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 6, 8, 4, 9, 14, 3, 11, 13, 5, 2, 1, 10, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {134,
-0,
+UINT64_C(0x10d0449dc15d3c4e),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 6, 8, 4, 9, 14, 3, 11, 13, 5, 2, 1, 10, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {135,
-0,
+UINT64_C(0x79088729202cf102),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 6, 8, 4, 9, 14, 3, 11, 13, 5, 2, 1, 10, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {136,
-0,
+UINT64_C(0x7908872c102cf102),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 6, 8, 4, 9, 14, 3, 11, 13, 5, 2, 1, 10, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {137,
-0,
+UINT64_C(0xb93c4fdb031d6582),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 3, 5, 8, 13, 12, 7, 14, 10, 2, 6, 1, 11, 4, 9},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {138,
-0,
+UINT64_C(0x7094202c88e1f882),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 8, 3, 6, 11, 9, 5, 12, 14, 7, 4, 1, 10, 2, 13},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {139,
-0,
+UINT64_C(0x7094202ccbe1f882),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 8, 3, 6, 11, 9, 5, 12, 14, 7, 4, 1, 10, 2, 13},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {140,
-0,
+UINT64_C(0xd6c8374af2ed4db2),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 3, 5, 8, 12, 11, 7, 13, 9, 2, 6, 1, 10, 4, 14},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {141,
-0,
+UINT64_C(0xd6c8323af2ed4db2),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 3, 5, 8, 12, 11, 7, 13, 9, 2, 6, 1, 10, 4, 14},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {142,
-0,
+UINT64_C(0x7904202c88e1f882),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 8, 3, 6, 11, 9, 5, 12, 14, 7, 4, 1, 10, 2, 13},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {143,
-0,
+UINT64_C(0x7904202ccbe1f882),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 8, 3, 6, 11, 9, 5, 12, 14, 7, 4, 1, 10, 2, 13},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {144,
-0,
+UINT64_C(0xa0db349dc15d3c45),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 6, 8, 4, 9, 14, 3, 11, 13, 5, 2, 1, 10, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {145,
-0,
+UINT64_C(0xc90ca55c00e1f009),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 6, 8, 4, 9, 14, 3, 11, 13, 5, 2, 1, 10, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {146,
-0,
+UINT64_C(0xc094250bcae86888),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 6, 8, 4, 9, 13, 3, 10, 12, 5, 2, 1, 14, 7, 11},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {147,
-0,
+UINT64_C(0xc094202ccbe86888),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 6, 8, 4, 9, 13, 3, 10, 12, 5, 2, 1, 14, 7, 11},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {148,
-0,
+UINT64_C(0xa7e725d5c5e0fb82),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 3, 5, 8, 12, 11, 7, 13, 9, 2, 6, 1, 10, 4, 14},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {149,
-0,
+UINT64_C(0xa7e725d578e0fb82),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 3, 5, 8, 12, 11, 7, 13, 9, 2, 6, 1, 10, 4, 14},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {150,
-0,
+UINT64_C(0xc094250bcae1f888),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 6, 8, 4, 9, 13, 3, 10, 12, 5, 2, 1, 14, 7, 11},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {151,
-0,
+UINT64_C(0xc094202ccbe1f888),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 6, 8, 4, 9, 13, 3, 10, 12, 5, 2, 1, 14, 7, 11},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {152,
-0,
+UINT64_C(0xa0d4c0084ee5f685),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{7,8,13},{2,8,13},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 8, 10, 3, 14, 7, 12, 13, 5, 1, 11, 2, 6, 9, 4},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,8,13},{8,2,13},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {153,
-0,
+UINT64_C(0x790ca02c88e1f002),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 6, 8, 4, 9, 14, 3, 11, 13, 5, 2, 1, 10, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {154,
-0,
+UINT64_C(0x790ca55c88e1f002),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 6, 8, 4, 9, 14, 3, 11, 13, 5, 2, 1, 10, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {155,
-0,
+UINT64_C(0x1d2b349dc15d3c4e),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 6, 8, 4, 9, 14, 3, 11, 13, 5, 2, 1, 10, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {156,
-0,
+UINT64_C(0x10db349dc15d3c4e),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 6, 8, 4, 9, 14, 3, 11, 13, 5, 2, 1, 10, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {157,
-0,
+UINT64_C(0x790ca02c00e1f002),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 6, 8, 4, 9, 14, 3, 11, 13, 5, 2, 1, 10, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {158,
-0,
+UINT64_C(0x790ca55c00e1f002),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 6, 8, 4, 9, 14, 3, 11, 13, 5, 2, 1, 10, 7, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {159,
-0,
+UINT64_C(0xc904255c42e1f009),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 8, 10, 3, 14, 7, 12, 13, 5, 1, 11, 2, 6, 9, 4},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {160,
-0,
+UINT64_C(0xc0942592cae1f888),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 3, 5, 8, 12, 11, 7, 13, 10, 2, 6, 1, 14, 4, 9},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {161,
-0,
+UINT64_C(0xc0942592cae1fcc8),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 3, 5, 8, 12, 11, 7, 13, 10, 2, 6, 1, 14, 4, 9},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {162,
-0,
+UINT64_C(0xae7725d5c5e0fb82),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 3, 5, 8, 12, 11, 7, 13, 9, 2, 6, 1, 10, 4, 14},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {163,
-0,
+UINT64_C(0xae7725d578e0fb82),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 3, 5, 8, 12, 11, 7, 13, 9, 2, 6, 1, 10, 4, 14},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {164,
-0,
+UINT64_C(0x0ef2a093c5e96cf8),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 4, 6, 2, 12, 11, 8, 13, 10, 3, 7, 1, 14, 5, 9},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {165,
-0,
+UINT64_C(0x0ef2a093c5e5acf8),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{2,8,10},{0,8,10},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 4, 6, 2, 12, 11, 8, 13, 10, 3, 7, 1, 14, 5, 9},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,8,10},{8,0,10},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {166,
-0,
+UINT64_C(0x406c20b5cbe8622e),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 9, 7, 14, 1, 3, 13, 5, 11, 10, 6, 8, 4, 2, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {167,
-0,
+UINT64_C(0xd96c2592cae1f22e),
 32,
 4,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 7, 3, 6, 10, 9, 5, 11, 13, 8, 4, 1, 14, 2, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {168,
-0,
+UINT64_C(0x406c2592cae1f22e),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 13, 7, 12, 2, 9, 5, 3, 11, 14, 1, 6, 10, 8, 4},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {169,
-0,
+UINT64_C(0x406c2592cae1f22e),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 9, 7, 14, 1, 3, 13, 5, 11, 10, 6, 8, 4, 2, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {170,
-0,
+UINT64_C(0x406c2592cae8622e),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 9, 7, 14, 1, 3, 13, 5, 11, 10, 6, 8, 4, 2, 12},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {171,
-0,
+UINT64_C(0xf06c77b5cbe2f225),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 5, 7, 4, 8, 13, 3, 10, 14, 12, 2, 1, 9, 6, 11},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {172,
-0,
+UINT64_C(0xf06c2592cae1f225),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 5, 7, 4, 8, 13, 3, 10, 14, 12, 2, 1, 9, 6, 11},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {173,
-0,
+UINT64_C(0xf06c772ccbe2f225),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 14, 10, 13, 3, 4, 8, 7, 5, 12, 2, 9, 1, 11, 6},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {174,
-0,
+UINT64_C(0xf06c250bcae86225),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 4, 12, 1, 14, 10, 6, 8, 2, 3, 13, 5, 9, 11, 7},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {175,
-0,
+UINT64_C(0x406c250bcae1f22e),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 7, 9, 1, 14, 13, 3, 11, 5, 6, 10, 2, 12, 8, 4},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {176,
-0,
+UINT64_C(0x406c250bcae8622e),
 36,
 2,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{4,8,12},{0,8,12},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 7, 9, 1, 14, 13, 3, 11, 5, 6, 10, 2, 12, 8, 4},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{8,4,12},{0,8,12},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {177,
-0,
+UINT64_C(0xc3a34765ba411401),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 3, 7, 9, 5, 4, 8, 12, 14, 10, 6, 2, 11, 1, 13},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {178,
-0,
+UINT64_C(0xc3ac5765ba411401),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 3, 7, 9, 5, 4, 8, 12, 14, 10, 6, 2, 11, 1, 13},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {179,
-0,
+UINT64_C(0xc3ac5765ba8d1401),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 5, 7, 4, 8, 12, 3, 9, 14, 11, 2, 1, 13, 6, 10},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {180,
-0,
+UINT64_C(0xc6953405118d4101),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{3,9,12},{1,9,12},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 3, 7, 9, 5, 4, 8, 13, 11, 10, 6, 2, 12, 1, 14},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,9,12},{9,1,12},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {181,
-0,
+UINT64_C(0x406c250bcae8622e),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 3, 7, 10, 6, 4, 9, 13, 12, 11, 8, 2, 5, 1, 14},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {182,
-0,
+UINT64_C(0x406c250bcae1f22e),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 3, 7, 10, 6, 4, 9, 13, 12, 11, 8, 2, 5, 1, 14},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {183,
-0,
+UINT64_C(0xf06c250bcae86225),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 6, 4, 13, 3, 7, 12, 10, 9, 8, 11, 5, 2, 1, 14},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {184,
-0,
+UINT64_C(0xf06c772ccbe2f225),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 8, 14, 2, 12, 6, 10, 4, 1, 7, 11, 9, 5, 13, 3},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {185,
-0,
+UINT64_C(0x403e072ccbe2f321),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 5, 7, 4, 8, 13, 3, 10, 14, 12, 2, 1, 9, 6, 11},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {186,
-0,
+UINT64_C(0x0eff244d79048108),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 7, 9, 1, 14, 13, 3, 11, 5, 6, 10, 2, 12, 8, 4},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {187,
-0,
+UINT64_C(0xa76f212c78e96122),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 10, 8, 12, 7, 3, 13, 6, 4, 11, 14, 9, 1, 2, 5},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {188,
-0,
+UINT64_C(0xf06c250bcae1f225),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 3, 7, 10, 6, 4, 9, 13, 12, 11, 8, 2, 5, 1, 14},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {189,
-0,
+UINT64_C(0x0ef314d479048108),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 7, 9, 1, 14, 13, 3, 11, 5, 6, 10, 2, 12, 8, 4},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {190,
-0,
+UINT64_C(0xa76f212c78056122),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 6, 4, 13, 3, 7, 12, 10, 8, 14, 11, 5, 2, 1, 9},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {191,
-0,
+UINT64_C(0x0ef3144d79048108),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 7, 9, 1, 14, 13, 3, 11, 5, 6, 10, 2, 12, 8, 4},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {192,
-0,
+UINT64_C(0xf06c2592cae1f225),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 3, 5, 2, 12, 11, 7, 13, 9, 10, 6, 1, 14, 4, 8},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {193,
-0,
+UINT64_C(0xf06c77b5cbe2f225),
 38,
 2,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 3, 5, 2, 12, 11, 7, 13, 9, 10, 6, 1, 14, 4, 8},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {194,
-0,
+UINT64_C(0xf06c245d891d1205),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{7,8,13},{2,8,13},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 5, 7, 4, 8, 13, 3, 10, 14, 12, 2, 1, 9, 6, 11},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,8,13},{8,2,13},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {195,
-0,
+UINT64_C(0xf06c250bcae1f225),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 5, 7, 4, 8, 13, 3, 10, 14, 12, 2, 1, 9, 6, 11},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {196,
-0,
+UINT64_C(0x0eff2592c5e96128),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 7, 9, 1, 14, 13, 3, 11, 5, 6, 10, 2, 12, 8, 4},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {197,
-0,
+UINT64_C(0xa7bc25c5780cf122),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 3, 5, 2, 12, 11, 7, 14, 9, 10, 6, 1, 13, 4, 8},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {198,
-0,
+UINT64_C(0x0eff250bc5e96128),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 7, 9, 1, 14, 13, 3, 11, 5, 6, 10, 2, 12, 8, 4},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {199,
-0,
+UINT64_C(0x0ef2c693c5e96658),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 14, 8, 12, 2, 10, 6, 1, 4, 11, 7, 13, 3, 9, 5},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {200,
-0,
+UINT64_C(0x0e2c250bcae0f128),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 4, 10, 12, 2, 1, 14, 8, 6, 5, 9, 11, 7, 3, 13},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {201,
-0,
+UINT64_C(0xf06c2592cae86225),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 12, 4, 14, 1, 6, 10, 2, 8, 13, 3, 11, 7, 5, 9},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {202,
-0,
+UINT64_C(0x0ef2c693c5e0f128),
 40,
 2,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{7,11,13},{6,11,13}}},
+{0, 3, 5, 2, 12, 11, 7, 13, 9, 10, 6, 1, 14, 4, 8},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{11,7,13},{6,11,13}}},
 
 {203,
-0,
+UINT64_C(0x0ef2c693c5e96128),
 42,
 2,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 7, 9, 1, 14, 13, 3, 11, 5, 6, 10, 2, 12, 8, 4},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {204,
-0,
+UINT64_C(0x0e2c2592cae0f128),
 44,
 2,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 3, 5, 2, 12, 11, 7, 13, 9, 10, 6, 1, 14, 4, 8},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {205,
-0,
+UINT64_C(0x406c2592cae8622e),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{5,9,10},{1,9,10},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 12, 4, 14, 1, 6, 10, 2, 8, 13, 3, 11, 7, 5, 9},
+{{1,10,12},{10,0,12},{9,5,10},{1,9,10},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {206,
-0,
+UINT64_C(0x6fbd010949d50e1c),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{1,5,10},{1,5,9},{0,2,10},{0,2,8},{5,10,13},{2,10,13},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 7, 3, 6, 10, 8, 4, 12, 13, 14, 11, 1, 9, 2, 5},
+{{1,10,12},{10,0,12},{1,5,10},{5,1,9},{2,0,10},{0,2,8},{10,5,13},{2,10,13},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {207,
-0,
+UINT64_C(0x0ef21593c5e0f128),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{1,5,10},{1,5,9},{0,2,10},{0,2,8},{5,10,13},{2,10,13},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{4,11,12},{3,11,12},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 14, 12, 10, 6, 8, 4, 1, 2, 9, 5, 11, 7, 13, 3},
+{{1,10,12},{10,0,12},{1,5,10},{5,1,9},{2,0,10},{0,2,8},{10,5,13},{2,10,13},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,11,12},{11,3,12},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {208,
-0,
+UINT64_C(0x97f2cf03c5e96128),
 46,
 3,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{1,5,10},{1,5,9},{0,2,10},{0,2,8},{5,10,13},{2,10,13},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 7, 3, 6, 9, 8, 4, 11, 12, 13, 10, 1, 14, 2, 5},
+{{1,10,12},{10,0,12},{1,5,10},{5,1,9},{2,0,10},{0,2,8},{10,5,13},{2,10,13},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {209,
-0,
+UINT64_C(0xf06c250bcae1f225),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{1,5,10},{1,5,9},{0,2,10},{0,2,8},{5,10,13},{2,10,13},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 6, 12, 8, 4, 1, 14, 10, 2, 7, 11, 13, 3, 5, 9},
+{{1,10,12},{10,0,12},{1,5,10},{5,1,9},{2,0,10},{0,2,8},{10,5,13},{2,10,13},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {210,
-0,
+UINT64_C(0x406c25c5cae1f22e),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{1,5,10},{1,5,9},{0,2,10},{0,2,8},{5,10,13},{2,10,13},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 4, 10, 12, 2, 1, 14, 8, 6, 5, 9, 11, 7, 3, 13},
+{{1,10,12},{10,0,12},{1,5,10},{5,1,9},{2,0,10},{0,2,8},{10,5,13},{2,10,13},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {211,
-0,
+UINT64_C(0x97f2cf03c5e96128),
 49,
 2,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{1,5,10},{1,5,9},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{7,8,11},{4,8,11},{6,7,13},{6,7,11}}},
+{0, 2, 10, 1, 14, 8, 4, 12, 6, 7, 11, 3, 13, 9, 5},
+{{1,10,12},{10,0,12},{1,5,10},{5,1,9},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{8,7,11},{4,8,11},{6,7,13},{7,6,11}}},
 
 {212,
-0,
+UINT64_C(0xf06c2592cae1f225),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{1,5,10},{1,5,9},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{6,9,13},{5,9,13},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 4, 10, 12, 2, 1, 14, 8, 6, 5, 9, 11, 7, 3, 13},
+{{1,10,12},{10,0,12},{1,5,10},{5,1,9},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{9,6,13},{5,9,13},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {213,
-0,
+UINT64_C(0x97f2cf03c5e96128),
 51,
 2,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{1,5,10},{1,5,9},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{7,8,13},{2,8,13},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 8, 3, 7, 10, 14, 1, 5, 12, 13, 4, 2, 11, 9, 6},
+{{1,10,12},{10,0,12},{1,5,10},{5,1,9},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,8,13},{8,2,13},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {214,
-0,
+UINT64_C(0x406c250bcae1f22e),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{1,5,10},{1,5,9},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{6,9,11},{3,9,11},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 10, 4, 2, 12, 14, 1, 6, 8, 9, 5, 3, 13, 11, 7},
+{{1,10,12},{10,0,12},{1,5,10},{5,1,9},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,9,11},{9,3,11},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {215,
-0,
+UINT64_C(0x0ef2c693c5e0f128),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{1,5,10},{1,5,9},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{7,11,13},{6,11,13}}},
+{0, 6, 8, 1, 14, 12, 2, 10, 4, 5, 9, 7, 11, 13, 3},
+{{1,10,12},{10,0,12},{1,5,10},{5,1,9},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{11,7,13},{6,11,13}}},
 
 {216,
-0,
+UINT64_C(0x406c2592cae1f22e),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{1,10,12},{0,10,12},{1,5,10},{1,5,9},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 10, 4, 2, 12, 14, 1, 6, 8, 9, 5, 3, 13, 11, 7},
+{{1,10,12},{10,0,12},{1,5,10},{5,1,9},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 {217,
-0,
+UINT64_C(0xd96c2592cae1f22e),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,1,12},{0,1,10},{1,5,10},{1,5,9},{0,2,10},{0,2,8},{2,5,13},{2,5,10},{0,4,12},{0,4,8},{1,3,12},{1,3,9},{3,4,12},{3,4,11},{5,6,13},{5,6,9},{3,6,11},{3,6,9},{2,7,13},{2,7,8},{4,7,11},{4,7,8},{6,7,13},{6,7,11}}},
+{0, 2, 1, 8, 4, 10, 6, 12, 14, 9, 5, 7, 11, 3, 13},
+{{1,0,12},{0,1,10},{1,5,10},{5,1,9},{2,0,10},{0,2,8},{2,5,13},{5,2,10},{0,4,12},{4,0,8},{3,1,12},{1,3,9},{4,3,12},{3,4,11},{5,6,13},{6,5,9},{6,3,11},{3,6,9},{7,2,13},{2,7,8},{4,7,11},{7,4,8},{6,7,13},{7,6,11}}},
 
 };
 
-graph_t graphs_dcub[NUM_DCUB_GRAPHS] = {
+const graph_t graphs_dcub[NUM_DCUB_GRAPHS] = {
 
 {0,
-0,
+UINT64_C(0x4dc0aa4ae3bd00f7),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,9,15},{5,12,14},{6,8,11},{1,7,8},{1,8,9},{1,7,9},{7,10,13},{2,10,11},{2,11,12},{2,10,12},{3,13,14},{3,14,15},{3,13,15},{7,9,15},{7,13,15},{4,6,8},{4,8,9},{10,12,14},{10,13,14},{4,5,14},{4,14,15},{5,6,11},{5,11,12},{7,8,11},{7,10,11}}},
+{0, 12, 16, 14, 7, 2, 3, 11, 15, 10, 9, 5, 13, 4, 6, 1, 8},
+{{4,0,5},{5,0,6},{0,4,6},{9,4,15},{5,12,14},{6,8,11},{1,7,8},{1,8,9},{7,1,9},{10,7,13},{10,2,11},{11,2,12},{2,10,12},{13,3,14},{14,3,15},{3,13,15},{7,9,15},{13,7,15},{6,4,8},{8,4,9},{12,10,14},{10,13,14},{4,5,14},{4,14,15},{5,6,11},{5,11,12},{8,7,11},{7,10,11}}},
 
 {1,
-0,
+UINT64_C(0xc7206a64776ce060),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,9,15},{5,12,14},{6,8,11},{1,7,8},{1,8,9},{1,7,9},{7,10,13},{2,10,11},{2,11,12},{2,10,12},{3,13,14},{3,14,15},{3,13,15},{7,9,15},{7,13,15},{4,6,8},{4,8,9},{10,12,14},{10,13,14},{4,5,14},{4,14,15},{5,6,11},{5,11,12},{7,8,10},{8,10,11}}},
+{0, 12, 16, 14, 7, 2, 3, 11, 15, 10, 9, 5, 13, 4, 6, 1, 8},
+{{4,0,5},{5,0,6},{0,4,6},{9,4,15},{5,12,14},{6,8,11},{1,7,8},{1,8,9},{7,1,9},{10,7,13},{10,2,11},{11,2,12},{2,10,12},{13,3,14},{14,3,15},{3,13,15},{7,9,15},{13,7,15},{6,4,8},{8,4,9},{12,10,14},{10,13,14},{4,5,14},{4,14,15},{5,6,11},{5,11,12},{8,7,10},{8,10,11}}},
 
 {2,
-0,
+UINT64_C(0x4cce3a98dcb23050),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,9,15},{5,12,14},{6,8,11},{1,7,8},{1,8,9},{1,7,9},{7,10,13},{2,10,11},{2,11,12},{2,10,12},{3,13,14},{3,14,15},{3,13,15},{7,9,15},{7,13,15},{4,6,8},{4,8,9},{10,12,14},{10,13,14},{4,5,14},{4,14,15},{5,6,12},{6,11,12},{7,8,11},{7,10,11}}},
+{0, 7, 14, 16, 12, 1, 8, 6, 13, 5, 4, 10, 15, 9, 11, 2, 3},
+{{4,0,5},{5,0,6},{0,4,6},{9,4,15},{5,12,14},{6,8,11},{1,7,8},{1,8,9},{7,1,9},{10,7,13},{10,2,11},{11,2,12},{2,10,12},{13,3,14},{14,3,15},{3,13,15},{7,9,15},{13,7,15},{6,4,8},{8,4,9},{12,10,14},{10,13,14},{4,5,14},{4,14,15},{5,6,12},{6,11,12},{8,7,11},{7,10,11}}},
 
 {3,
-0,
+UINT64_C(0xd7206aa21c6deaf0),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,9,15},{5,12,14},{6,8,11},{1,7,8},{1,8,9},{1,7,9},{7,10,13},{2,10,11},{2,11,12},{2,10,12},{3,13,14},{3,14,15},{3,13,15},{7,9,15},{7,13,15},{4,6,8},{4,8,9},{10,12,14},{10,13,14},{4,5,14},{4,14,15},{5,6,12},{6,11,12},{7,8,10},{8,10,11}}},
+{0, 7, 14, 16, 12, 1, 8, 6, 13, 5, 4, 10, 15, 9, 11, 2, 3},
+{{4,0,5},{5,0,6},{0,4,6},{9,4,15},{5,12,14},{6,8,11},{1,7,8},{1,8,9},{7,1,9},{10,7,13},{10,2,11},{11,2,12},{2,10,12},{13,3,14},{14,3,15},{3,13,15},{7,9,15},{13,7,15},{6,4,8},{8,4,9},{12,10,14},{10,13,14},{4,5,14},{4,14,15},{5,6,12},{6,11,12},{8,7,10},{8,10,11}}},
 
 {4,
-0,
+UINT64_C(0xd3f3b082caa0c13e),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,9,15},{5,12,14},{6,8,11},{1,7,8},{1,8,9},{1,7,9},{7,10,13},{2,10,11},{2,11,12},{2,10,12},{3,13,14},{3,14,15},{3,13,15},{7,9,15},{7,13,15},{4,6,8},{4,8,9},{10,12,14},{10,13,14},{4,5,15},{5,14,15},{5,6,11},{5,11,12},{7,8,11},{7,10,11}}},
+{0, 4, 14, 16, 9, 3, 1, 5, 11, 13, 12, 15, 6, 7, 10, 8, 2},
+{{4,0,5},{5,0,6},{0,4,6},{9,4,15},{5,12,14},{6,8,11},{1,7,8},{1,8,9},{7,1,9},{10,7,13},{10,2,11},{11,2,12},{2,10,12},{13,3,14},{14,3,15},{3,13,15},{7,9,15},{13,7,15},{6,4,8},{8,4,9},{12,10,14},{10,13,14},{4,5,15},{5,14,15},{5,6,11},{5,11,12},{8,7,11},{7,10,11}}},
 
 {5,
-0,
+UINT64_C(0x4cce3a904cb23050),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,9,15},{5,12,14},{6,8,11},{1,7,8},{1,8,9},{1,7,9},{7,10,13},{2,10,11},{2,11,12},{2,10,12},{3,13,14},{3,14,15},{3,13,15},{7,9,15},{7,13,15},{4,6,8},{4,8,9},{10,12,14},{10,13,14},{4,5,15},{5,14,15},{5,6,12},{6,11,12},{7,8,11},{7,10,11}}},
+{0, 14, 12, 16, 7, 4, 5, 13, 2, 11, 3, 9, 10, 15, 8, 6, 1},
+{{4,0,5},{5,0,6},{0,4,6},{9,4,15},{5,12,14},{6,8,11},{1,7,8},{1,8,9},{7,1,9},{10,7,13},{10,2,11},{11,2,12},{2,10,12},{13,3,14},{14,3,15},{3,13,15},{7,9,15},{13,7,15},{6,4,8},{8,4,9},{12,10,14},{10,13,14},{4,5,15},{5,14,15},{5,6,12},{6,11,12},{8,7,11},{7,10,11}}},
 
 {6,
-0,
+UINT64_C(0x62093f9dd9f7d856),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,9,15},{5,12,14},{6,8,11},{1,7,8},{1,8,9},{1,7,9},{7,10,13},{2,10,11},{2,11,12},{2,10,12},{3,13,14},{3,14,15},{3,13,15},{7,9,15},{7,13,15},{4,6,8},{4,8,9},{10,12,13},{12,13,14},{4,5,14},{4,14,15},{5,6,11},{5,11,12},{7,8,11},{7,10,11}}},
+{0, 16, 4, 9, 15, 13, 11, 12, 1, 3, 5, 8, 2, 10, 7, 14, 6},
+{{4,0,5},{5,0,6},{0,4,6},{9,4,15},{5,12,14},{6,8,11},{1,7,8},{1,8,9},{7,1,9},{10,7,13},{10,2,11},{11,2,12},{2,10,12},{13,3,14},{14,3,15},{3,13,15},{7,9,15},{13,7,15},{6,4,8},{8,4,9},{12,10,13},{12,13,14},{4,5,14},{4,14,15},{5,6,11},{5,11,12},{8,7,11},{7,10,11}}},
 
 {7,
-0,
+UINT64_C(0x62093f9dd98fd856),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,9,15},{5,12,14},{6,8,11},{1,7,8},{1,8,9},{1,7,9},{7,10,13},{2,10,11},{2,11,12},{2,10,12},{3,13,14},{3,14,15},{3,13,15},{7,9,15},{7,13,15},{4,6,8},{4,8,9},{10,12,13},{12,13,14},{4,5,14},{4,14,15},{5,6,11},{5,11,12},{7,8,10},{8,10,11}}},
+{0, 4, 9, 16, 15, 1, 5, 3, 10, 2, 8, 11, 12, 13, 14, 6, 7},
+{{4,0,5},{5,0,6},{0,4,6},{9,4,15},{5,12,14},{6,8,11},{1,7,8},{1,8,9},{7,1,9},{10,7,13},{10,2,11},{11,2,12},{2,10,12},{13,3,14},{14,3,15},{3,13,15},{7,9,15},{13,7,15},{6,4,8},{8,4,9},{12,10,13},{12,13,14},{4,5,14},{4,14,15},{5,6,11},{5,11,12},{8,7,10},{8,10,11}}},
 
 {8,
-0,
+UINT64_C(0xfe573a91c6373fa8),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,9,15},{5,12,14},{6,8,11},{1,7,8},{1,8,9},{1,7,9},{7,10,13},{2,10,11},{2,11,12},{2,10,12},{3,13,14},{3,14,15},{3,13,15},{7,9,15},{7,13,15},{4,6,8},{4,8,9},{10,12,13},{12,13,14},{4,5,14},{4,14,15},{5,6,12},{6,11,12},{7,8,11},{7,10,11}}},
+{0, 15, 7, 13, 11, 9, 16, 14, 1, 6, 8, 4, 5, 12, 3, 10, 2},
+{{4,0,5},{5,0,6},{0,4,6},{9,4,15},{5,12,14},{6,8,11},{1,7,8},{1,8,9},{7,1,9},{10,7,13},{10,2,11},{11,2,12},{2,10,12},{13,3,14},{14,3,15},{3,13,15},{7,9,15},{13,7,15},{6,4,8},{8,4,9},{12,10,13},{12,13,14},{4,5,14},{4,14,15},{5,6,12},{6,11,12},{8,7,11},{7,10,11}}},
 
 {9,
-0,
+UINT64_C(0x68d4451919281118),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,9,15},{5,12,14},{6,8,11},{1,7,8},{1,8,9},{1,7,9},{7,10,13},{2,10,11},{2,11,12},{2,10,12},{3,13,14},{3,14,15},{3,13,15},{7,9,15},{7,13,15},{4,6,8},{4,8,9},{10,12,13},{12,13,14},{4,5,15},{5,14,15},{5,6,12},{6,11,12},{7,8,10},{8,10,11}}},
+{0, 14, 12, 16, 8, 5, 6, 13, 3, 11, 4, 10, 15, 9, 2, 7, 1},
+{{4,0,5},{5,0,6},{0,4,6},{9,4,15},{5,12,14},{6,8,11},{1,7,8},{1,8,9},{7,1,9},{10,7,13},{10,2,11},{11,2,12},{2,10,12},{13,3,14},{14,3,15},{3,13,15},{7,9,15},{13,7,15},{6,4,8},{8,4,9},{12,10,13},{12,13,14},{4,5,15},{5,14,15},{5,6,12},{6,11,12},{8,7,10},{8,10,11}}},
 
 {10,
-0,
+UINT64_C(0xf2ec1e2f8dffea89),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,9,15},{5,12,14},{6,8,11},{1,7,8},{1,8,9},{1,7,9},{7,10,13},{2,10,11},{2,11,12},{2,10,12},{3,13,14},{3,14,15},{3,13,15},{7,9,15},{7,13,15},{4,6,9},{6,8,9},{10,12,13},{12,13,14},{4,5,14},{4,14,15},{5,6,11},{5,11,12},{7,8,10},{8,10,11}}},
+{0, 16, 7, 13, 11, 9, 15, 8, 1, 6, 2, 5, 14, 12, 4, 10, 3},
+{{4,0,5},{5,0,6},{0,4,6},{9,4,15},{5,12,14},{6,8,11},{1,7,8},{1,8,9},{7,1,9},{10,7,13},{10,2,11},{11,2,12},{2,10,12},{13,3,14},{14,3,15},{3,13,15},{7,9,15},{13,7,15},{6,4,9},{8,6,9},{12,10,13},{12,13,14},{4,5,14},{4,14,15},{5,6,11},{5,11,12},{8,7,10},{8,10,11}}},
 
 {11,
-0,
+UINT64_C(0xf1fc3a6d83bc071a),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,9,15},{5,12,14},{6,8,11},{1,7,8},{1,8,9},{1,7,9},{7,10,13},{2,10,11},{2,11,12},{2,10,12},{3,13,14},{3,14,15},{3,13,15},{7,9,13},{9,13,15},{4,6,8},{4,8,9},{10,12,14},{10,13,14},{4,5,15},{5,14,15},{5,6,12},{6,11,12},{7,8,11},{7,10,11}}},
+{0, 15, 7, 13, 10, 8, 16, 14, 1, 6, 2, 4, 5, 12, 3, 11, 9},
+{{4,0,5},{5,0,6},{0,4,6},{9,4,15},{5,12,14},{6,8,11},{1,7,8},{1,8,9},{7,1,9},{10,7,13},{10,2,11},{11,2,12},{2,10,12},{13,3,14},{14,3,15},{3,13,15},{7,9,13},{13,9,15},{6,4,8},{8,4,9},{12,10,14},{10,13,14},{4,5,15},{5,14,15},{5,6,12},{6,11,12},{8,7,11},{7,10,11}}},
 
 };
 
-graph_t graphs_dhex[NUM_DHEX_GRAPHS] = {
+const graph_t graphs_dhex[NUM_DHEX_GRAPHS] = {
 
 {0,
-0,
+UINT64_C(0x2d492f39c29d1cf7),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{1,7,9},{7,9,13},{2,10,11},{2,11,12},{2,10,12},{11,12,14},{3,13,14},{3,14,15},{3,13,15},{7,12,14},{7,13,14},{4,9,13},{4,13,15},{4,5,8},{4,8,9},{7,8,10},{7,10,12},{6,11,14},{6,14,15},{5,6,11},{5,10,11}}},
+{0, 14, 11, 16, 4, 13, 15, 6, 2, 10, 12, 9, 7, 8, 3, 1, 5},
+{{0,4,5},{0,5,6},{4,0,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{7,1,9},{7,9,13},{10,2,11},{11,2,12},{2,10,12},{11,12,14},{13,3,14},{14,3,15},{3,13,15},{12,7,14},{7,13,14},{9,4,13},{13,4,15},{5,4,8},{8,4,9},{8,7,10},{10,7,12},{6,11,14},{6,14,15},{6,5,11},{5,10,11}}},
 
 {1,
-0,
+UINT64_C(0x02440f7bb26d6cd5),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{1,7,9},{7,9,13},{2,10,11},{2,11,12},{2,10,12},{11,12,14},{3,13,14},{3,14,15},{3,13,15},{7,12,14},{7,13,14},{4,9,13},{4,13,15},{4,5,8},{4,8,9},{7,8,10},{7,10,12},{6,11,14},{6,14,15},{5,6,10},{6,10,11}}},
+{0, 14, 11, 16, 4, 13, 15, 6, 2, 10, 12, 9, 7, 8, 3, 1, 5},
+{{0,4,5},{0,5,6},{4,0,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{7,1,9},{7,9,13},{10,2,11},{11,2,12},{2,10,12},{11,12,14},{13,3,14},{14,3,15},{3,13,15},{12,7,14},{7,13,14},{9,4,13},{13,4,15},{5,4,8},{8,4,9},{8,7,10},{10,7,12},{6,11,14},{6,14,15},{6,5,10},{6,10,11}}},
 
 {2,
-0,
+UINT64_C(0xfe573a91c6373fa8),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{1,7,9},{7,9,13},{2,10,11},{2,11,12},{2,10,12},{11,12,14},{3,13,14},{3,14,15},{3,13,15},{7,12,14},{7,13,14},{4,9,13},{4,13,15},{4,5,8},{4,8,9},{7,8,10},{7,10,12},{6,11,15},{11,14,15},{5,6,11},{5,10,11}}},
+{0, 15, 7, 13, 11, 9, 14, 16, 1, 6, 8, 5, 12, 4, 2, 3, 10},
+{{0,4,5},{0,5,6},{4,0,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{7,1,9},{7,9,13},{10,2,11},{11,2,12},{2,10,12},{11,12,14},{13,3,14},{14,3,15},{3,13,15},{12,7,14},{7,13,14},{9,4,13},{13,4,15},{5,4,8},{8,4,9},{8,7,10},{10,7,12},{6,11,15},{11,14,15},{6,5,11},{5,10,11}}},
 
 {3,
-0,
+UINT64_C(0x62093f9dd9f7d856),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{1,7,9},{7,9,13},{2,10,11},{2,11,12},{2,10,12},{11,12,14},{3,13,14},{3,14,15},{3,13,15},{7,12,14},{7,13,14},{4,9,13},{4,13,15},{4,5,8},{4,8,9},{7,8,10},{7,10,12},{6,11,15},{11,14,15},{5,6,10},{6,10,11}}},
+{0, 16, 4, 9, 15, 13, 12, 11, 1, 3, 5, 2, 10, 8, 6, 7, 14},
+{{0,4,5},{0,5,6},{4,0,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{7,1,9},{7,9,13},{10,2,11},{11,2,12},{2,10,12},{11,12,14},{13,3,14},{14,3,15},{3,13,15},{12,7,14},{7,13,14},{9,4,13},{13,4,15},{5,4,8},{8,4,9},{8,7,10},{10,7,12},{6,11,15},{11,14,15},{6,5,10},{6,10,11}}},
 
 {4,
-0,
+UINT64_C(0x6209371dd9f7d856),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{1,7,9},{7,9,13},{2,10,11},{2,11,12},{2,10,12},{11,12,14},{3,13,14},{3,14,15},{3,13,15},{7,12,14},{7,13,14},{4,9,13},{4,13,15},{4,5,8},{4,8,9},{7,8,12},{8,10,12},{6,11,14},{6,14,15},{5,6,11},{5,10,11}}},
+{0, 4, 9, 16, 15, 1, 3, 5, 10, 2, 8, 12, 13, 11, 7, 14, 6},
+{{0,4,5},{0,5,6},{4,0,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{7,1,9},{7,9,13},{10,2,11},{11,2,12},{2,10,12},{11,12,14},{13,3,14},{14,3,15},{3,13,15},{12,7,14},{7,13,14},{9,4,13},{13,4,15},{5,4,8},{8,4,9},{8,7,12},{10,8,12},{6,11,14},{6,14,15},{6,5,11},{5,10,11}}},
 
 {5,
-0,
+UINT64_C(0xe8ac4c7919281110),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{1,7,9},{7,9,13},{2,10,11},{2,11,12},{2,10,12},{11,12,14},{3,13,14},{3,14,15},{3,13,15},{7,12,14},{7,13,14},{4,9,13},{4,13,15},{4,5,8},{4,8,9},{7,8,12},{8,10,12},{6,11,14},{6,14,15},{5,6,10},{6,10,11}}},
+{0, 8, 14, 16, 12, 1, 7, 2, 13, 6, 5, 9, 10, 15, 4, 11, 3},
+{{0,4,5},{0,5,6},{4,0,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{7,1,9},{7,9,13},{10,2,11},{11,2,12},{2,10,12},{11,12,14},{13,3,14},{14,3,15},{3,13,15},{12,7,14},{7,13,14},{9,4,13},{13,4,15},{5,4,8},{8,4,9},{8,7,12},{10,8,12},{6,11,14},{6,14,15},{6,5,10},{6,10,11}}},
 
 {6,
-0,
+UINT64_C(0x62093f9dd98fd856),
 53,
 2,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{1,7,9},{7,9,13},{2,10,11},{2,11,12},{2,10,12},{11,12,14},{3,13,14},{3,14,15},{3,13,15},{7,12,14},{7,13,14},{4,9,13},{4,13,15},{4,5,8},{4,8,9},{7,8,12},{8,10,12},{6,11,15},{11,14,15},{5,6,10},{6,10,11}}},
+{0, 4, 9, 16, 15, 1, 3, 5, 10, 2, 8, 12, 13, 11, 7, 14, 6},
+{{0,4,5},{0,5,6},{4,0,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{7,1,9},{7,9,13},{10,2,11},{11,2,12},{2,10,12},{11,12,14},{13,3,14},{14,3,15},{3,13,15},{12,7,14},{7,13,14},{9,4,13},{13,4,15},{5,4,8},{8,4,9},{8,7,12},{10,8,12},{6,11,15},{11,14,15},{6,5,10},{6,10,11}}},
 
 {7,
-0,
+UINT64_C(0x2d49e109d29d1cf7),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{1,7,9},{7,9,13},{2,10,11},{2,11,12},{2,10,12},{11,12,14},{3,13,14},{3,14,15},{3,13,15},{7,12,14},{7,13,14},{4,9,13},{4,13,15},{4,5,9},{5,8,9},{7,8,10},{7,10,12},{6,11,14},{6,14,15},{5,6,11},{5,10,11}}},
+{0, 14, 11, 16, 4, 13, 15, 6, 2, 10, 12, 9, 7, 8, 3, 1, 5},
+{{0,4,5},{0,5,6},{4,0,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{7,1,9},{7,9,13},{10,2,11},{11,2,12},{2,10,12},{11,12,14},{13,3,14},{14,3,15},{3,13,15},{12,7,14},{7,13,14},{9,4,13},{13,4,15},{5,4,9},{8,5,9},{8,7,10},{10,7,12},{6,11,14},{6,14,15},{6,5,11},{5,10,11}}},
 
 {8,
-0,
+UINT64_C(0x27cf300852413040),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{1,7,9},{7,9,13},{2,10,11},{2,11,12},{2,10,12},{11,12,14},{3,13,14},{3,14,15},{3,13,15},{7,12,14},{7,13,14},{4,9,13},{4,13,15},{4,5,9},{5,8,9},{7,8,10},{7,10,12},{6,11,14},{6,14,15},{5,6,10},{6,10,11}}},
+{0, 12, 14, 7, 16, 11, 3, 2, 5, 4, 13, 1, 8, 6, 15, 9, 10},
+{{0,4,5},{0,5,6},{4,0,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{7,1,9},{7,9,13},{10,2,11},{11,2,12},{2,10,12},{11,12,14},{13,3,14},{14,3,15},{3,13,15},{12,7,14},{7,13,14},{9,4,13},{13,4,15},{5,4,9},{8,5,9},{8,7,10},{10,7,12},{6,11,14},{6,14,15},{6,5,10},{6,10,11}}},
 
 {9,
-0,
+UINT64_C(0xc3ae293f1626c128),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{1,7,9},{7,9,13},{2,10,11},{2,11,12},{2,10,12},{11,12,14},{3,13,14},{3,14,15},{3,13,15},{7,12,14},{7,13,14},{4,9,13},{4,13,15},{4,5,9},{5,8,9},{7,8,12},{8,10,12},{6,11,14},{6,14,15},{5,6,11},{5,10,11}}},
+{0, 8, 12, 14, 16, 2, 1, 7, 11, 4, 3, 5, 6, 13, 10, 15, 9},
+{{0,4,5},{0,5,6},{4,0,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{7,1,9},{7,9,13},{10,2,11},{11,2,12},{2,10,12},{11,12,14},{13,3,14},{14,3,15},{3,13,15},{12,7,14},{7,13,14},{9,4,13},{13,4,15},{5,4,9},{8,5,9},{8,7,12},{10,8,12},{6,11,14},{6,14,15},{6,5,11},{5,10,11}}},
 
 {10,
-0,
+UINT64_C(0x76a1db874f7ecf63),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{1,7,9},{7,9,13},{2,10,11},{2,11,12},{2,10,12},{11,12,14},{3,13,14},{3,14,15},{3,13,15},{7,12,14},{7,13,14},{4,9,13},{4,13,15},{4,5,9},{5,8,9},{7,8,12},{8,10,12},{6,11,14},{6,14,15},{5,6,10},{6,10,11}}},
+{0, 10, 15, 13, 7, 9, 11, 2, 5, 14, 16, 12, 3, 4, 6, 1, 8},
+{{0,4,5},{0,5,6},{4,0,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{7,1,9},{7,9,13},{10,2,11},{11,2,12},{2,10,12},{11,12,14},{13,3,14},{14,3,15},{3,13,15},{12,7,14},{7,13,14},{9,4,13},{13,4,15},{5,4,9},{8,5,9},{8,7,12},{10,8,12},{6,11,14},{6,14,15},{6,5,10},{6,10,11}}},
 
 {11,
-0,
+UINT64_C(0xf2ec1e2f8dffea89),
 55,
 4,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{1,7,9},{7,9,13},{2,10,11},{2,11,12},{2,10,12},{11,12,14},{3,13,14},{3,14,15},{3,13,15},{7,12,14},{7,13,14},{4,9,13},{4,13,15},{4,5,9},{5,8,9},{7,8,12},{8,10,12},{6,11,15},{11,14,15},{5,6,10},{6,10,11}}},
+{0, 7, 13, 16, 11, 1, 6, 2, 12, 14, 5, 8, 9, 15, 4, 10, 3},
+{{0,4,5},{0,5,6},{4,0,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{7,1,9},{7,9,13},{10,2,11},{11,2,12},{2,10,12},{11,12,14},{13,3,14},{14,3,15},{3,13,15},{12,7,14},{7,13,14},{9,4,13},{13,4,15},{5,4,9},{8,5,9},{8,7,12},{10,8,12},{6,11,15},{11,14,15},{6,5,10},{6,10,11}}},
 
 {12,
-0,
+UINT64_C(0x76f2db2dd9e7cf63),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{1,7,9},{7,9,13},{2,10,11},{2,11,12},{2,10,12},{11,12,14},{3,13,14},{3,14,15},{3,13,15},{7,12,14},{7,13,14},{4,9,15},{9,13,15},{4,5,8},{4,8,9},{7,8,10},{7,10,12},{6,11,14},{6,14,15},{5,6,11},{5,10,11}}},
+{0, 16, 6, 13, 9, 15, 14, 11, 1, 5, 7, 4, 12, 3, 8, 2, 10},
+{{0,4,5},{0,5,6},{4,0,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{7,1,9},{7,9,13},{10,2,11},{11,2,12},{2,10,12},{11,12,14},{13,3,14},{14,3,15},{3,13,15},{12,7,14},{7,13,14},{9,4,15},{13,9,15},{5,4,8},{8,4,9},{8,7,10},{10,7,12},{6,11,14},{6,14,15},{6,5,11},{5,10,11}}},
 
 {13,
-0,
+UINT64_C(0x56fce5952b4063f8),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{1,7,9},{7,9,13},{2,10,11},{2,11,12},{2,10,12},{11,12,14},{3,13,14},{3,14,15},{3,13,15},{7,12,14},{7,13,14},{4,9,15},{9,13,15},{4,5,8},{4,8,9},{7,8,10},{7,10,12},{6,11,14},{6,14,15},{5,6,10},{6,10,11}}},
+{0, 5, 15, 16, 12, 4, 6, 1, 10, 14, 13, 7, 8, 9, 11, 2, 3},
+{{0,4,5},{0,5,6},{4,0,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{7,1,9},{7,9,13},{10,2,11},{11,2,12},{2,10,12},{11,12,14},{13,3,14},{14,3,15},{3,13,15},{12,7,14},{7,13,14},{9,4,15},{13,9,15},{5,4,8},{8,4,9},{8,7,10},{10,7,12},{6,11,14},{6,14,15},{6,5,10},{6,10,11}}},
 
 {14,
-0,
+UINT64_C(0xc3d629691626c128),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{1,7,9},{7,9,13},{2,10,11},{2,11,12},{2,10,12},{11,12,14},{3,13,14},{3,14,15},{3,13,15},{7,12,14},{7,13,14},{4,9,15},{9,13,15},{4,5,8},{4,8,9},{7,8,12},{8,10,12},{6,11,14},{6,14,15},{5,6,11},{5,10,11}}},
+{0, 14, 8, 12, 16, 6, 5, 13, 2, 1, 7, 4, 11, 3, 9, 10, 15},
+{{0,4,5},{0,5,6},{4,0,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{7,1,9},{7,9,13},{10,2,11},{11,2,12},{2,10,12},{11,12,14},{13,3,14},{14,3,15},{3,13,15},{12,7,14},{7,13,14},{9,4,15},{13,9,15},{5,4,8},{8,4,9},{8,7,12},{10,8,12},{6,11,14},{6,14,15},{6,5,11},{5,10,11}}},
 
 {15,
-0,
+UINT64_C(0x69f00490279013f4),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{1,7,9},{7,9,13},{2,10,11},{2,11,12},{2,10,12},{11,12,14},{3,13,14},{3,14,15},{3,13,15},{7,12,14},{7,13,14},{4,9,15},{9,13,15},{4,5,8},{4,8,9},{7,8,12},{8,10,12},{6,11,14},{6,14,15},{5,6,10},{6,10,11}}},
+{0, 5, 15, 16, 12, 4, 6, 1, 10, 14, 13, 7, 8, 9, 11, 2, 3},
+{{0,4,5},{0,5,6},{4,0,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{7,1,9},{7,9,13},{10,2,11},{11,2,12},{2,10,12},{11,12,14},{13,3,14},{14,3,15},{3,13,15},{12,7,14},{7,13,14},{9,4,15},{13,9,15},{5,4,8},{8,4,9},{8,7,12},{10,8,12},{6,11,14},{6,14,15},{6,5,10},{6,10,11}}},
 
 {16,
-0,
+UINT64_C(0x1fbc5c6b4de32abc),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{1,7,9},{7,9,13},{2,10,11},{2,11,12},{2,10,12},{11,12,14},{3,13,14},{3,14,15},{3,13,15},{7,12,14},{7,13,14},{4,9,15},{9,13,15},{4,5,9},{5,8,9},{7,8,10},{7,10,12},{6,11,14},{6,14,15},{5,6,11},{5,10,11}}},
+{0, 16, 8, 15, 12, 10, 9, 13, 1, 7, 2, 6, 14, 5, 3, 4, 11},
+{{0,4,5},{0,5,6},{4,0,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{7,1,9},{7,9,13},{10,2,11},{11,2,12},{2,10,12},{11,12,14},{13,3,14},{14,3,15},{3,13,15},{12,7,14},{7,13,14},{9,4,15},{13,9,15},{5,4,9},{8,5,9},{8,7,10},{10,7,12},{6,11,14},{6,14,15},{6,5,11},{5,10,11}}},
 
 {17,
-0,
+UINT64_C(0x27cf300852413b20),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{1,7,9},{7,9,13},{2,10,11},{2,11,12},{2,10,12},{11,12,14},{3,13,14},{3,14,15},{3,13,15},{7,12,14},{7,13,14},{4,9,15},{9,13,15},{4,5,9},{5,8,9},{7,8,10},{7,10,12},{6,11,14},{6,14,15},{5,6,10},{6,10,11}}},
+{0, 12, 14, 7, 16, 11, 3, 2, 5, 4, 13, 1, 8, 6, 15, 9, 10},
+{{0,4,5},{0,5,6},{4,0,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{7,1,9},{7,9,13},{10,2,11},{11,2,12},{2,10,12},{11,12,14},{13,3,14},{14,3,15},{3,13,15},{12,7,14},{7,13,14},{9,4,15},{13,9,15},{5,4,9},{8,5,9},{8,7,10},{10,7,12},{6,11,14},{6,14,15},{6,5,10},{6,10,11}}},
 
 {18,
-0,
+UINT64_C(0x4cce3a98dcbd1050),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{1,7,9},{7,9,13},{2,10,11},{2,11,12},{2,10,12},{11,12,14},{3,13,14},{3,14,15},{3,13,15},{7,12,14},{7,13,14},{4,9,15},{9,13,15},{4,5,9},{5,8,9},{7,8,12},{8,10,12},{6,11,14},{6,14,15},{5,6,11},{5,10,11}}},
+{0, 7, 12, 14, 16, 8, 1, 6, 11, 3, 2, 4, 5, 13, 10, 15, 9},
+{{0,4,5},{0,5,6},{4,0,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{7,1,9},{7,9,13},{10,2,11},{11,2,12},{2,10,12},{11,12,14},{13,3,14},{14,3,15},{3,13,15},{12,7,14},{7,13,14},{9,4,15},{13,9,15},{5,4,9},{8,5,9},{8,7,12},{10,8,12},{6,11,14},{6,14,15},{6,5,11},{5,10,11}}},
 
 {19,
-0,
+UINT64_C(0x69680490279013f4),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{1,7,9},{7,9,13},{2,10,11},{2,11,12},{2,10,12},{11,12,14},{3,13,14},{3,14,15},{3,13,15},{7,12,14},{7,13,14},{4,9,15},{9,13,15},{4,5,9},{5,8,9},{7,8,12},{8,10,12},{6,11,14},{6,14,15},{5,6,10},{6,10,11}}},
+{0, 5, 15, 16, 12, 4, 6, 1, 10, 14, 13, 7, 8, 9, 11, 2, 3},
+{{0,4,5},{0,5,6},{4,0,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{7,1,9},{7,9,13},{10,2,11},{11,2,12},{2,10,12},{11,12,14},{13,3,14},{14,3,15},{3,13,15},{12,7,14},{7,13,14},{9,4,15},{13,9,15},{5,4,9},{8,5,9},{8,7,12},{10,8,12},{6,11,14},{6,14,15},{6,5,10},{6,10,11}}},
 
 {20,
-0,
+UINT64_C(0xf1fc3a6d83bc071a),
 59,
 4,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{1,7,9},{7,9,13},{2,10,11},{2,11,12},{2,10,12},{11,12,14},{3,13,14},{3,14,15},{3,13,15},{7,12,13},{12,13,14},{4,9,15},{9,13,15},{4,5,8},{4,8,9},{7,8,10},{7,10,12},{6,11,14},{6,14,15},{5,6,11},{5,10,11}}},
+{0, 7, 13, 15, 10, 1, 6, 2, 12, 5, 4, 14, 8, 16, 11, 9, 3},
+{{0,4,5},{0,5,6},{4,0,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{7,1,9},{7,9,13},{10,2,11},{11,2,12},{2,10,12},{11,12,14},{13,3,14},{14,3,15},{3,13,15},{12,7,13},{12,13,14},{9,4,15},{13,9,15},{5,4,8},{8,4,9},{8,7,10},{10,7,12},{6,11,14},{6,14,15},{6,5,11},{5,10,11}}},
 
 {21,
-0,
+UINT64_C(0x4cce3a904cb23050),
 63,
 2,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{1,7,9},{7,9,13},{2,10,11},{2,11,12},{2,10,12},{11,12,14},{3,13,14},{3,14,15},{3,13,15},{7,12,13},{12,13,14},{4,9,15},{9,13,15},{4,5,8},{4,8,9},{7,8,10},{7,10,12},{6,11,14},{6,14,15},{5,6,10},{6,10,11}}},
+{0, 12, 14, 7, 16, 11, 3, 2, 5, 4, 13, 1, 8, 6, 15, 9, 10},
+{{0,4,5},{0,5,6},{4,0,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{7,1,9},{7,9,13},{10,2,11},{11,2,12},{2,10,12},{11,12,14},{13,3,14},{14,3,15},{3,13,15},{12,7,13},{12,13,14},{9,4,15},{13,9,15},{5,4,8},{8,4,9},{8,7,10},{10,7,12},{6,11,14},{6,14,15},{6,5,10},{6,10,11}}},
 
 {22,
-0,
+UINT64_C(0x4cce3a98dcb23050),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{1,7,9},{7,9,13},{2,10,11},{2,11,12},{2,10,12},{11,12,14},{3,13,14},{3,14,15},{3,13,15},{7,12,13},{12,13,14},{4,9,15},{9,13,15},{4,5,8},{4,8,9},{7,8,12},{8,10,12},{6,11,14},{6,14,15},{5,6,10},{6,10,11}}},
+{0, 14, 7, 12, 16, 5, 4, 13, 8, 1, 6, 3, 11, 2, 9, 10, 15},
+{{0,4,5},{0,5,6},{4,0,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{7,1,9},{7,9,13},{10,2,11},{11,2,12},{2,10,12},{11,12,14},{13,3,14},{14,3,15},{3,13,15},{12,7,13},{12,13,14},{9,4,15},{13,9,15},{5,4,8},{8,4,9},{8,7,12},{10,8,12},{6,11,14},{6,14,15},{6,5,10},{6,10,11}}},
 
 {23,
-0,
+UINT64_C(0x68d4451919281118),
 0,
 1,
-{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-{{0,4,5},{0,5,6},{0,4,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{1,7,9},{7,9,13},{2,10,11},{2,11,12},{2,10,12},{11,12,14},{3,13,14},{3,14,15},{3,13,15},{7,12,13},{12,13,14},{4,9,15},{9,13,15},{4,5,9},{5,8,9},{7,8,12},{8,10,12},{6,11,14},{6,14,15},{5,6,10},{6,10,11}}},
+{0, 12, 8, 16, 14, 4, 3, 11, 7, 2, 1, 10, 15, 9, 6, 13, 5},
+{{0,4,5},{0,5,6},{4,0,6},{4,6,15},{5,8,10},{1,7,8},{1,8,9},{7,1,9},{7,9,13},{10,2,11},{11,2,12},{2,10,12},{11,12,14},{13,3,14},{14,3,15},{3,13,15},{12,7,13},{12,13,14},{9,4,15},{13,9,15},{5,4,9},{8,5,9},{8,7,12},{10,8,12},{6,11,14},{6,14,15},{6,5,10},{6,10,11}}},
 
 };
 
@@ -33,15 +33,19 @@ typedef struct
 #define NUM_DCUB_GRAPHS 12
 #define NUM_DHEX_GRAPHS 24
 
-extern int8_t automorphisms[][PTM_MAX_POINTS];
-
-extern graph_t graphs_sc[NUM_SC_GRAPHS];
-extern graph_t graphs_fcc[NUM_FCC_GRAPHS];
-extern graph_t graphs_hcp[NUM_HCP_GRAPHS];
-extern graph_t graphs_ico[NUM_ICO_GRAPHS];
-extern graph_t graphs_bcc[NUM_BCC_GRAPHS];
-extern graph_t graphs_dcub[NUM_DCUB_GRAPHS];
-extern graph_t graphs_dhex[NUM_DHEX_GRAPHS];
+//the graphs are stored with clockwise facets, canonical labellings and hashes precomputed.
+//ptm_graph_data.cpp and ptm_graph_index.h are generated from datagen/dumped_data.txt by "make
+//graphdata"; unittest.cpp checks them against canonical_form_coloured
+
+extern const int8_t automorphisms[][PTM_MAX_POINTS];
+
+extern const graph_t graphs_sc[NUM_SC_GRAPHS];
+extern const graph_t graphs_fcc[NUM_FCC_GRAPHS];
+extern const graph_t graphs_hcp[NUM_HCP_GRAPHS];
+extern const graph_t graphs_ico[NUM_ICO_GRAPHS];
+extern const graph_t graphs_bcc[NUM_BCC_GRAPHS];
+extern const graph_t graphs_dcub[NUM_DCUB_GRAPHS];
+extern const graph_t graphs_dhex[NUM_DHEX_GRAPHS];
 
 }
 
@@ -0,0 +1,309 @@
+/*Copyright (c) 2016 PM Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+//generated by datagen/generate_graph_data from datagen/dumped_data.txt, do not edit
+
+#ifndef PTM_GRAPH_INDEX_H
+#define PTM_GRAPH_INDEX_H
+
+#include "ptm_initialize_data.h"
+
+namespace ptm {
+
+#define PTM_NUM_GRAPHS (NUM_SC_GRAPHS + NUM_FCC_GRAPHS + NUM_HCP_GRAPHS + NUM_ICO_GRAPHS + NUM_BCC_GRAPHS + NUM_DCUB_GRAPHS + NUM_DHEX_GRAPHS)
+
+//graphs of all structures sorted by canonical hash.  Entries with equal hashes are in the order
+//sc, fcc, hcp, ico, bcc, dcub, dhex, so that ties are resolved as in a per-structure search.
+static const graphentry_t graph_entries[PTM_NUM_GRAPHS] = {
+        {UINT64_C(0x02440f7bb26d6cd5), &structure_dhex, &graphs_dhex[1]},
+        {UINT64_C(0x03942592ca78fcc8), &structure_bcc, &graphs_bcc[60]},
+        {UINT64_C(0x0e2c250bcae0f128), &structure_bcc, &graphs_bcc[200]},
+        {UINT64_C(0x0e2c2592cae0f128), &structure_bcc, &graphs_bcc[204]},
+        {UINT64_C(0x0ef21593c5e0f128), &structure_bcc, &graphs_bcc[207]},
+        {UINT64_C(0x0ef2a093c5e5acf8), &structure_bcc, &graphs_bcc[165]},
+        {UINT64_C(0x0ef2a093c5e96cf8), &structure_bcc, &graphs_bcc[164]},
+        {UINT64_C(0x0ef2c693c5e0f128), &structure_bcc, &graphs_bcc[202]},
+        {UINT64_C(0x0ef2c693c5e0f128), &structure_bcc, &graphs_bcc[215]},
+        {UINT64_C(0x0ef2c693c5e96128), &structure_bcc, &graphs_bcc[203]},
+        {UINT64_C(0x0ef2c693c5e96658), &structure_bcc, &graphs_bcc[199]},
+        {UINT64_C(0x0ef3144d79048108), &structure_bcc, &graphs_bcc[191]},
+        {UINT64_C(0x0ef314d479048108), &structure_bcc, &graphs_bcc[189]},
+        {UINT64_C(0x0eff244d79048108), &structure_bcc, &graphs_bcc[186]},
+        {UINT64_C(0x0eff250bc5e96128), &structure_bcc, &graphs_bcc[198]},
+        {UINT64_C(0x0eff2592c5e96128), &structure_bcc, &graphs_bcc[196]},
+        {UINT64_C(0x0f2e0500305555e3), &structure_bcc, &graphs_bcc[63]},
+        {UINT64_C(0x0f2e0d80305555e3), &structure_bcc, &graphs_bcc[64]},
+        {UINT64_C(0x0f2e3400305555e3), &structure_bcc, &graphs_bcc[65]},
+        {UINT64_C(0x0f2e3c80305555e3), &structure_bcc, &graphs_bcc[66]},
+        {UINT64_C(0x102f343400df9aa1), &structure_bcc, &graphs_bcc[72]},
+        {UINT64_C(0x102f372400df9aa1), &structure_bcc, &graphs_bcc[71]},
+        {UINT64_C(0x10d0449dc15d3c4e), &structure_bcc, &graphs_bcc[134]},
+        {UINT64_C(0x10db349dc15d3c4e), &structure_bcc, &graphs_bcc[156]},
+        {UINT64_C(0x12fbc7bd4c291725), &structure_bcc, &graphs_bcc[86]},
+        {UINT64_C(0x12fbc7bd4c291754), &structure_bcc, &graphs_bcc[94]},
+        {UINT64_C(0x12fbcf3d4c291725), &structure_bcc, &graphs_bcc[85]},
+        {UINT64_C(0x12fbcf3d4c291754), &structure_bcc, &graphs_bcc[93]},
+        {UINT64_C(0x1a04255c4278f309), &structure_bcc, &graphs_bcc[59]},
+        {UINT64_C(0x1c4ee83dce844ae6), &structure_fcc, &graphs_fcc[0]},
+        {UINT64_C(0x1c4ee83dce844ae6), &structure_hcp, &graphs_hcp[3]},
+        {UINT64_C(0x1c4ee83dce844ae6), &structure_hcp, &graphs_hcp[11]},
+        {UINT64_C(0x1c4ee83dce8ddae6), &structure_hcp, &graphs_hcp[7]},
+        {UINT64_C(0x1d2b349dc15d3c4e), &structure_bcc, &graphs_bcc[155]},
+        {UINT64_C(0x1fbc5c6b4de32abc), &structure_dhex, &graphs_dhex[16]},
+        {UINT64_C(0x27cf300852413040), &structure_dhex, &graphs_dhex[8]},
+        {UINT64_C(0x27cf300852413b20), &structure_dhex, &graphs_dhex[17]},
+        {UINT64_C(0x2d492f39c29d1cf7), &structure_dhex, &graphs_dhex[0]},
+        {UINT64_C(0x2d49e109d29d1cf7), &structure_dhex, &graphs_dhex[7]},
+        {UINT64_C(0x2f2e05003055753c), &structure_bcc, &graphs_bcc[67]},
+        {UINT64_C(0x2f2e0d803055753c), &structure_bcc, &graphs_bcc[69]},
+        {UINT64_C(0x2f2e34003055753c), &structure_bcc, &graphs_bcc[68]},
+        {UINT64_C(0x2f2e3c803055753c), &structure_bcc, &graphs_bcc[70]},
+        {UINT64_C(0x3eb83faac2d48dfe), &structure_bcc, &graphs_bcc[21]},
+        {UINT64_C(0x3eb9fcce4c045dfe), &structure_bcc, &graphs_bcc[23]},
+        {UINT64_C(0x403e072ccbe2f321), &structure_bcc, &graphs_bcc[185]},
+        {UINT64_C(0x406c20b5cbe8622e), &structure_bcc, &graphs_bcc[166]},
+        {UINT64_C(0x406c250bcae1f22e), &structure_bcc, &graphs_bcc[175]},
+        {UINT64_C(0x406c250bcae1f22e), &structure_bcc, &graphs_bcc[182]},
+        {UINT64_C(0x406c250bcae1f22e), &structure_bcc, &graphs_bcc[214]},
+        {UINT64_C(0x406c250bcae8622e), &structure_bcc, &graphs_bcc[176]},
+        {UINT64_C(0x406c250bcae8622e), &structure_bcc, &graphs_bcc[181]},
+        {UINT64_C(0x406c2592cae1f22e), &structure_bcc, &graphs_bcc[168]},
+        {UINT64_C(0x406c2592cae1f22e), &structure_bcc, &graphs_bcc[169]},
+        {UINT64_C(0x406c2592cae1f22e), &structure_bcc, &graphs_bcc[216]},
+        {UINT64_C(0x406c2592cae8622e), &structure_bcc, &graphs_bcc[170]},
+        {UINT64_C(0x406c2592cae8622e), &structure_bcc, &graphs_bcc[205]},
+        {UINT64_C(0x406c25c5cae1f22e), &structure_bcc, &graphs_bcc[210]},
+        {UINT64_C(0x413e330130ed55eb), &structure_bcc, &graphs_bcc[118]},
+        {UINT64_C(0x41cf330130ed55eb), &structure_bcc, &graphs_bcc[117]},
+        {UINT64_C(0x45207f3ac2d48e44), &structure_bcc, &graphs_bcc[40]},
+        {UINT64_C(0x452e2c9a12ecccf3), &structure_bcc, &graphs_bcc[41]},
+        {UINT64_C(0x493e2f8a026455f3), &structure_bcc, &graphs_bcc[50]},
+        {UINT64_C(0x493e330400ed55e3), &structure_bcc, &graphs_bcc[83]},
+        {UINT64_C(0x493e371400ed3058), &structure_bcc, &graphs_bcc[112]},
+        {UINT64_C(0x493e371400ed5558), &structure_bcc, &graphs_bcc[82]},
+        {UINT64_C(0x493e371400ed5558), &structure_bcc, &graphs_bcc[104]},
+        {UINT64_C(0x493e371400ed55e3), &structure_bcc, &graphs_bcc[84]},
+        {UINT64_C(0x493e3714bbed3058), &structure_bcc, &graphs_bcc[110]},
+        {UINT64_C(0x493e3714bbed5558), &structure_bcc, &graphs_bcc[103]},
+        {UINT64_C(0x493e3b8400ed55e3), &structure_bcc, &graphs_bcc[78]},
+        {UINT64_C(0x493e3f9400ed55e3), &structure_bcc, &graphs_bcc[79]},
+        {UINT64_C(0x493edba04d8cc7f5), &structure_bcc, &graphs_bcc[49]},
+        {UINT64_C(0x49c0276400ed3058), &structure_bcc, &graphs_bcc[108]},
+        {UINT64_C(0x49c02764bbed3058), &structure_bcc, &graphs_bcc[106]},
+        {UINT64_C(0x49c02764bbed5558), &structure_bcc, &graphs_bcc[102]},
+        {UINT64_C(0x49c7477a02b83348), &structure_bcc, &graphs_bcc[54]},
+        {UINT64_C(0x49c8531a026455f3), &structure_bcc, &graphs_bcc[53]},
+        {UINT64_C(0x49cf2ffa02ecccf3), &structure_bcc, &graphs_bcc[43]},
+        {UINT64_C(0x4a842ecd4e06599d), &structure_bcc, &graphs_bcc[17]},
+        {UINT64_C(0x4a94929252716acd), &structure_bcc, &graphs_bcc[1]},
+        {UINT64_C(0x4a949293f1fbba9d), &structure_bcc, &graphs_bcc[2]},
+        {UINT64_C(0x4a94948252716acd), &structure_bcc, &graphs_bcc[10]},
+        {UINT64_C(0x4a9495c5fefbba9d), &structure_bcc, &graphs_bcc[11]},
+        {UINT64_C(0x4b1d052d2ec1eafc), &structure_bcc, &graphs_bcc[18]},
+        {UINT64_C(0x4b1d0d9d32dc91fc), &structure_bcc, &graphs_bcc[19]},
+        {UINT64_C(0x4b307f3ac2d48e44), &structure_bcc, &graphs_bcc[42]},
+        {UINT64_C(0x4cce3a904cb23050), &structure_dcub, &graphs_dcub[5]},
+        {UINT64_C(0x4cce3a904cb23050), &structure_dhex, &graphs_dhex[21]},
+        {UINT64_C(0x4cce3a98dcb23050), &structure_dcub, &graphs_dcub[2]},
+        {UINT64_C(0x4cce3a98dcb23050), &structure_dhex, &graphs_dhex[22]},
+        {UINT64_C(0x4cce3a98dcbd1050), &structure_dhex, &graphs_dhex[18]},
+        {UINT64_C(0x4dc0aa4ae3bd00f7), &structure_dcub, &graphs_dcub[0]},
+        {UINT64_C(0x4e5e8729202cf1d2), &structure_bcc, &graphs_bcc[95]},
+        {UINT64_C(0x4e5e872c102cf1d2), &structure_bcc, &graphs_bcc[96]},
+        {UINT64_C(0x4ea294a262716acd), &structure_bcc, &graphs_bcc[4]},
+        {UINT64_C(0x4ea295c5fcfaba9d), &structure_bcc, &graphs_bcc[5]},
+        {UINT64_C(0x4ea884a262716acd), &structure_bcc, &graphs_bcc[12]},
+        {UINT64_C(0x4ea947c6fcfaba9d), &structure_bcc, &graphs_bcc[13]},
+        {UINT64_C(0x4eb22ecd4c07599d), &structure_bcc, &graphs_bcc[30]},
+        {UINT64_C(0x4eb22faad28c89cd), &structure_bcc, &graphs_bcc[29]},
+        {UINT64_C(0x4eb83faad28c89cd), &structure_bcc, &graphs_bcc[31]},
+        {UINT64_C(0x4eb9fcce4c07599d), &structure_bcc, &graphs_bcc[32]},
+        {UINT64_C(0x4f2b0d9d32dcf10c), &structure_bcc, &graphs_bcc[33]},
+        {UINT64_C(0x4f2b0e95a221120c), &structure_bcc, &graphs_bcc[9]},
+        {UINT64_C(0x4f2f242e22318a0c), &structure_bcc, &graphs_bcc[27]},
+        {UINT64_C(0x4f2f242e2cc18a0c), &structure_bcc, &graphs_bcc[25]},
+        {UINT64_C(0x4f2f2c9a12ccf10c), &structure_bcc, &graphs_bcc[35]},
+        {UINT64_C(0x4f2f2f928231120c), &structure_bcc, &graphs_bcc[15]},
+        {UINT64_C(0x56fce5952b4063f8), &structure_dhex, &graphs_dhex[13]},
+        {UINT64_C(0x5a4ee1a204244a08), &structure_fcc, &graphs_fcc[4]},
+        {UINT64_C(0x5a4ee1a204244a08), &structure_fcc, &graphs_fcc[7]},
+        {UINT64_C(0x5a4ee1a204244a08), &structure_hcp, &graphs_hcp[14]},
+        {UINT64_C(0x5a4ee83dc4244ae6), &structure_hcp, &graphs_hcp[8]},
+        {UINT64_C(0x5b49e0adc4212c38), &structure_hcp, &graphs_hcp[6]},
+        {UINT64_C(0x6209371dd9f7d856), &structure_dhex, &graphs_dhex[4]},
+        {UINT64_C(0x62093f9dd98fd856), &structure_dcub, &graphs_dcub[7]},
+        {UINT64_C(0x62093f9dd98fd856), &structure_dhex, &graphs_dhex[6]},
+        {UINT64_C(0x62093f9dd9f7d856), &structure_dcub, &graphs_dcub[6]},
+        {UINT64_C(0x62093f9dd9f7d856), &structure_dhex, &graphs_dhex[3]},
+        {UINT64_C(0x68d4451919281118), &structure_dcub, &graphs_dcub[9]},
+        {UINT64_C(0x68d4451919281118), &structure_dhex, &graphs_dhex[23]},
+        {UINT64_C(0x69680490279013f4), &structure_dhex, &graphs_dhex[19]},
+        {UINT64_C(0x69f00490279013f4), &structure_dhex, &graphs_dhex[15]},
+        {UINT64_C(0x6a3c1c814c7cf685), &structure_bcc, &graphs_bcc[55]},
+        {UINT64_C(0x6a3c4fdb03946582), &structure_bcc, &graphs_bcc[57]},
+        {UINT64_C(0x6a3cbb814c7cf685), &structure_bcc, &graphs_bcc[56]},
+        {UINT64_C(0x6fbd010949d50e1c), &structure_bcc, &graphs_bcc[206]},
+        {UINT64_C(0x7094202c88e1f882), &structure_bcc, &graphs_bcc[138]},
+        {UINT64_C(0x7094202ccbe1f882), &structure_bcc, &graphs_bcc[131]},
+        {UINT64_C(0x7094202ccbe1f882), &structure_bcc, &graphs_bcc[139]},
+        {UINT64_C(0x7094202ccbe86882), &structure_bcc, &graphs_bcc[127]},
+        {UINT64_C(0x7094250bcae1f882), &structure_bcc, &graphs_bcc[130]},
+        {UINT64_C(0x7094250bcae86882), &structure_bcc, &graphs_bcc[126]},
+        {UINT64_C(0x722157395ff512eb), &structure_bcc, &graphs_bcc[48]},
+        {UINT64_C(0x7221575a5ff512eb), &structure_bcc, &graphs_bcc[47]},
+        {UINT64_C(0x73d4c0074e7cf685), &structure_bcc, &graphs_bcc[58]},
+        {UINT64_C(0x76a1db874f7ecf63), &structure_dhex, &graphs_dhex[10]},
+        {UINT64_C(0x76f2db2dd9e7cf63), &structure_dhex, &graphs_dhex[12]},
+        {UINT64_C(0x7706527a5df412eb), &structure_bcc, &graphs_bcc[44]},
+        {UINT64_C(0x7904202c88e1f882), &structure_bcc, &graphs_bcc[142]},
+        {UINT64_C(0x7904202ccbe1f882), &structure_bcc, &graphs_bcc[143]},
+        {UINT64_C(0x79088729202cf102), &structure_bcc, &graphs_bcc[135]},
+        {UINT64_C(0x79088729a82cf102), &structure_bcc, &graphs_bcc[132]},
+        {UINT64_C(0x7908872c102cf102), &structure_bcc, &graphs_bcc[136]},
+        {UINT64_C(0x7908872c982cf102), &structure_bcc, &graphs_bcc[133]},
+        {UINT64_C(0x790ca02c00e1f002), &structure_bcc, &graphs_bcc[157]},
+        {UINT64_C(0x790ca02c88e1f002), &structure_bcc, &graphs_bcc[153]},
+        {UINT64_C(0x790ca55c00e1f002), &structure_bcc, &graphs_bcc[158]},
+        {UINT64_C(0x790ca55c88e1f002), &structure_bcc, &graphs_bcc[154]},
+        {UINT64_C(0x7ca50bf4a1c162f9), &structure_bcc, &graphs_bcc[7]},
+        {UINT64_C(0x83fbc7bd4c291754), &structure_bcc, &graphs_bcc[62]},
+        {UINT64_C(0x83fbcf3d4c291754), &structure_bcc, &graphs_bcc[61]},
+        {UINT64_C(0x854ee83dc4244ae6), &structure_hcp, &graphs_hcp[10]},
+        {UINT64_C(0x854ee83dce844ae6), &structure_fcc, &graphs_fcc[2]},
+        {UINT64_C(0x854ee83dce844ae6), &structure_hcp, &graphs_hcp[2]},
+        {UINT64_C(0x854ee83dce844ae6), &structure_hcp, &graphs_hcp[12]},
+        {UINT64_C(0x901b79fc52d1fad9), &structure_bcc, &graphs_bcc[16]},
+        {UINT64_C(0x9549e0adc4212c38), &structure_hcp, &graphs_hcp[4]},
+        {UINT64_C(0x97f2cf03c5e96128), &structure_bcc, &graphs_bcc[208]},
+        {UINT64_C(0x97f2cf03c5e96128), &structure_bcc, &graphs_bcc[211]},
+        {UINT64_C(0x97f2cf03c5e96128), &structure_bcc, &graphs_bcc[213]},
+        {UINT64_C(0xa0d0449d495d3c45), &structure_bcc, &graphs_bcc[121]},
+        {UINT64_C(0xa0d4c0084ee5f685), &structure_bcc, &graphs_bcc[152]},
+        {UINT64_C(0xa0db349d495d3c45), &structure_bcc, &graphs_bcc[123]},
+        {UINT64_C(0xa0db349dc15d3c45), &structure_bcc, &graphs_bcc[144]},
+        {UINT64_C(0xa76f212c78056122), &structure_bcc, &graphs_bcc[190]},
+        {UINT64_C(0xa76f212c78e96122), &structure_bcc, &graphs_bcc[187]},
+        {UINT64_C(0xa7bc25c5780cf122), &structure_bcc, &graphs_bcc[197]},
+        {UINT64_C(0xa7e725d578e0fb82), &structure_bcc, &graphs_bcc[149]},
+        {UINT64_C(0xa7e725d5c5e0fb82), &structure_bcc, &graphs_bcc[148]},
+        {UINT64_C(0xae7725d578e0fb82), &structure_bcc, &graphs_bcc[163]},
+        {UINT64_C(0xae7725d5c5e0fb82), &structure_bcc, &graphs_bcc[162]},
+        {UINT64_C(0xb02f273a02318aa6), &structure_bcc, &graphs_bcc[26]},
+        {UINT64_C(0xb02f273a0231dea6), &structure_bcc, &graphs_bcc[28]},
+        {UINT64_C(0xb02f273a12443ca6), &structure_bcc, &graphs_bcc[46]},
+        {UINT64_C(0xb51d052a3221eaa8), &structure_bcc, &graphs_bcc[20]},
+        {UINT64_C(0xb7201fcac2d48e48), &structure_bcc, &graphs_bcc[22]},
+        {UINT64_C(0xb72e2c9a12ccfcff), &structure_bcc, &graphs_bcc[24]},
+        {UINT64_C(0xb93c4fdb031d6582), &structure_bcc, &graphs_bcc[137]},
+        {UINT64_C(0xb97e7cbb132d4582), &structure_bcc, &graphs_bcc[125]},
+        {UINT64_C(0xbc211cc242716aca), &structure_bcc, &graphs_bcc[14]},
+        {UINT64_C(0xbc211fcad28c89ca), &structure_bcc, &graphs_bcc[34]},
+        {UINT64_C(0xbc2b0cc242716aca), &structure_bcc, &graphs_bcc[8]},
+        {UINT64_C(0xbda0e098a21132c1), &structure_bcc, &graphs_bcc[0]},
+        {UINT64_C(0xbe1a0bf2726132c1), &structure_bcc, &graphs_bcc[6]},
+        {UINT64_C(0xc094202ccbe1f888), &structure_bcc, &graphs_bcc[151]},
+        {UINT64_C(0xc094202ccbe86888), &structure_bcc, &graphs_bcc[147]},
+        {UINT64_C(0xc094250bcae1f888), &structure_bcc, &graphs_bcc[150]},
+        {UINT64_C(0xc094250bcae86888), &structure_bcc, &graphs_bcc[146]},
+        {UINT64_C(0xc0942592cae1f888), &structure_bcc, &graphs_bcc[160]},
+        {UINT64_C(0xc0942592cae1fcc8), &structure_bcc, &graphs_bcc[161]},
+        {UINT64_C(0xc13e330130ed55e3), &structure_bcc, &graphs_bcc[111]},
+        {UINT64_C(0xc13e33018bed55e3), &structure_bcc, &graphs_bcc[109]},
+        {UINT64_C(0xc13e3304006555e3), &structure_bcc, &graphs_bcc[89]},
+        {UINT64_C(0xc13e3b84006555e3), &structure_bcc, &graphs_bcc[90]},
+        {UINT64_C(0xc1cf330130ed55e3), &structure_bcc, &graphs_bcc[107]},
+        {UINT64_C(0xc1cf3301842d55e3), &structure_bcc, &graphs_bcc[101]},
+        {UINT64_C(0xc1cf33018bed55e3), &structure_bcc, &graphs_bcc[105]},
+        {UINT64_C(0xc1cf3304006555e3), &structure_bcc, &graphs_bcc[97]},
+        {UINT64_C(0xc1cf3b84006555e3), &structure_bcc, &graphs_bcc[98]},
+        {UINT64_C(0xc249e93dce812cd6), &structure_fcc, &graphs_fcc[1]},
+        {UINT64_C(0xc2a85f5ac2d48df2), &structure_bcc, &graphs_bcc[38]},
+        {UINT64_C(0xc34ee83dce844ae6), &structure_hcp, &graphs_hcp[1]},
+        {UINT64_C(0xc367fbc04d045df2), &structure_bcc, &graphs_bcc[39]},
+        {UINT64_C(0xc3a34765ba411401), &structure_bcc, &graphs_bcc[177]},
+        {UINT64_C(0xc3ac5765ba411401), &structure_bcc, &graphs_bcc[178]},
+        {UINT64_C(0xc3ac5765ba8d1401), &structure_bcc, &graphs_bcc[179]},
+        {UINT64_C(0xc3ae293f1626c128), &structure_dhex, &graphs_dhex[9]},
+        {UINT64_C(0xc3d629691626c128), &structure_dhex, &graphs_dhex[14]},
+        {UINT64_C(0xc6953405118d4101), &structure_bcc, &graphs_bcc[180]},
+        {UINT64_C(0xc7206a64776ce060), &structure_dcub, &graphs_dcub[1]},
+        {UINT64_C(0xc74aeba0e451098a), &structure_fcc, &graphs_fcc[3]},
+        {UINT64_C(0xc74aeba0e4544a8b), &structure_fcc, &graphs_fcc[5]},
+        {UINT64_C(0xc7a846142e0eb142), &structure_sc, &graphs_sc[0]},
+        {UINT64_C(0xc904255c42e1f009), &structure_bcc, &graphs_bcc[159]},
+        {UINT64_C(0xc904772c10e2f009), &structure_bcc, &graphs_bcc[114]},
+        {UINT64_C(0xc908872c982cf109), &structure_bcc, &graphs_bcc[122]},
+        {UINT64_C(0xc90ca02c00e1f009), &structure_bcc, &graphs_bcc[88]},
+        {UINT64_C(0xc90ca55c00e1f009), &structure_bcc, &graphs_bcc[145]},
+        {UINT64_C(0xc90ca55c88e1f009), &structure_bcc, &graphs_bcc[124]},
+        {UINT64_C(0xc93e371400ed3050), &structure_bcc, &graphs_bcc[120]},
+        {UINT64_C(0xc93e3714bbed3050), &structure_bcc, &graphs_bcc[116]},
+        {UINT64_C(0xc9c0276400ed3050), &structure_bcc, &graphs_bcc[119]},
+        {UINT64_C(0xc9c02764bbed3050), &structure_bcc, &graphs_bcc[115]},
+        {UINT64_C(0xc9c7576400ed3fa0), &structure_bcc, &graphs_bcc[91]},
+        {UINT64_C(0xc9c75764bbed3fa0), &structure_bcc, &graphs_bcc[99]},
+        {UINT64_C(0xc9c8476400ed3fa0), &structure_bcc, &graphs_bcc[92]},
+        {UINT64_C(0xc9c84764bbed3fa0), &structure_bcc, &graphs_bcc[100]},
+        {UINT64_C(0xccb85f5ac2d48df2), &structure_bcc, &graphs_bcc[36]},
+        {UINT64_C(0xccb9fcc04d045df2), &structure_bcc, &graphs_bcc[37]},
+        {UINT64_C(0xd3f3b082caa0c13e), &structure_dcub, &graphs_dcub[4]},
+        {UINT64_C(0xd6c8323af2ed4d09), &structure_bcc, &graphs_bcc[129]},
+        {UINT64_C(0xd6c8323af2ed4db2), &structure_bcc, &graphs_bcc[141]},
+        {UINT64_C(0xd6c8374af2ed4d09), &structure_bcc, &graphs_bcc[128]},
+        {UINT64_C(0xd6c8374af2ed4db2), &structure_bcc, &graphs_bcc[140]},
+        {UINT64_C(0xd7206aa21c6deaf0), &structure_dcub, &graphs_dcub[3]},
+        {UINT64_C(0xd96c2592cae1f22e), &structure_bcc, &graphs_bcc[167]},
+        {UINT64_C(0xd96c2592cae1f22e), &structure_bcc, &graphs_bcc[217]},
+        {UINT64_C(0xe04340a252212c6b), &structure_fcc, &graphs_fcc[6]},
+        {UINT64_C(0xe04340a252212c6b), &structure_hcp, &graphs_hcp[5]},
+        {UINT64_C(0xe04340a252212c6b), &structure_hcp, &graphs_hcp[15]},
+        {UINT64_C(0xe04340a252212c6b), &structure_ico, &graphs_ico[0]},
+        {UINT64_C(0xe8ac4c7919281110), &structure_dhex, &graphs_dhex[5]},
+        {UINT64_C(0xec4feb3fce8446c4), &structure_hcp, &graphs_hcp[0]},
+        {UINT64_C(0xec9ceb3dce844a24), &structure_hcp, &graphs_hcp[9]},
+        {UINT64_C(0xec9ceb3dce8dda24), &structure_hcp, &graphs_hcp[13]},
+        {UINT64_C(0xeda495c5fefbb591), &structure_bcc, &graphs_bcc[3]},
+        {UINT64_C(0xf06c245d891d1205), &structure_bcc, &graphs_bcc[194]},
+        {UINT64_C(0xf06c250bcae1f225), &structure_bcc, &graphs_bcc[188]},
+        {UINT64_C(0xf06c250bcae1f225), &structure_bcc, &graphs_bcc[195]},
+        {UINT64_C(0xf06c250bcae1f225), &structure_bcc, &graphs_bcc[209]},
+        {UINT64_C(0xf06c250bcae86225), &structure_bcc, &graphs_bcc[174]},
+        {UINT64_C(0xf06c250bcae86225), &structure_bcc, &graphs_bcc[183]},
+        {UINT64_C(0xf06c2592cae1f225), &structure_bcc, &graphs_bcc[172]},
+        {UINT64_C(0xf06c2592cae1f225), &structure_bcc, &graphs_bcc[192]},
+        {UINT64_C(0xf06c2592cae1f225), &structure_bcc, &graphs_bcc[212]},
+        {UINT64_C(0xf06c2592cae86225), &structure_bcc, &graphs_bcc[201]},
+        {UINT64_C(0xf06c772ccbe2f225), &structure_bcc, &graphs_bcc[173]},
+        {UINT64_C(0xf06c772ccbe2f225), &structure_bcc, &graphs_bcc[184]},
+        {UINT64_C(0xf06c77b5cbe2f225), &structure_bcc, &graphs_bcc[171]},
+        {UINT64_C(0xf06c77b5cbe2f225), &structure_bcc, &graphs_bcc[193]},
+        {UINT64_C(0xf1fc3a6d83bc071a), &structure_dcub, &graphs_dcub[11]},
+        {UINT64_C(0xf1fc3a6d83bc071a), &structure_dhex, &graphs_dhex[20]},
+        {UINT64_C(0xf2ec1e2f8dffea89), &structure_dcub, &graphs_dcub[10]},
+        {UINT64_C(0xf2ec1e2f8dffea89), &structure_dhex, &graphs_dhex[11]},
+        {UINT64_C(0xf321dba34115c4e2), &structure_bcc, &graphs_bcc[80]},
+        {UINT64_C(0xf321dba3411c54e2), &structure_bcc, &graphs_bcc[74]},
+        {UINT64_C(0xf366dba34115c4e2), &structure_bcc, &graphs_bcc[76]},
+        {UINT64_C(0xf3a9dba34115c4e2), &structure_bcc, &graphs_bcc[75]},
+        {UINT64_C(0xf3a9dba3411c54e2), &structure_bcc, &graphs_bcc[73]},
+        {UINT64_C(0xf3eedba34115c4e2), &structure_bcc, &graphs_bcc[81]},
+        {UINT64_C(0xf3eedba3411c54e2), &structure_bcc, &graphs_bcc[77]},
+        {UINT64_C(0xfa2f827a302f19e8), &structure_bcc, &graphs_bcc[45]},
+        {UINT64_C(0xfe08871c00f11ee6), &structure_bcc, &graphs_bcc[52]},
+        {UINT64_C(0xfe08875a302f19e6), &structure_bcc, &graphs_bcc[51]},
+        {UINT64_C(0xfe573a91c6373fa8), &structure_dcub, &graphs_dcub[8]},
+        {UINT64_C(0xfe573a91c6373fa8), &structure_dhex, &graphs_dhex[2]},
+        {UINT64_C(0xfe5e8729202cf1d9), &structure_bcc, &graphs_bcc[87]},
+        {UINT64_C(0xfe5f874a203cfbe9), &structure_bcc, &graphs_bcc[113]},
+};
+
+}
+
+#endif
+
@@ -13,12 +13,14 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include "ptm_deformation_gradient.h"
 #include "ptm_functions.h"
 #include "ptm_graph_data.h"
+#include "ptm_index.h"
 #include "ptm_initialize_data.h"
 #include "ptm_multishell.h"
 #include "ptm_neighbour_ordering.h"
 #include "ptm_normalize_vertices.h"
 #include "ptm_polar.h"
 #include "ptm_quat.h"
+#include "ptm_stats.h"
 #include "ptm_structure_matcher.h"
 #include <algorithm>
 #include <cassert>
@@ -53,84 +55,82 @@ static double calculate_lattice_constant(int type,
 	return c[type] * interatomic_distance;
 }
 
-static int rotate_into_fundamental_zone(int type,
-					bool output_conventional_orientation,
-					double *q) {
-	if (type == PTM_MATCH_SC)
-		return ptm::rotate_quaternion_into_cubic_fundamental_zone(q);
-	if (type == PTM_MATCH_FCC)
-		return ptm::rotate_quaternion_into_cubic_fundamental_zone(q);
-	if (type == PTM_MATCH_BCC)
-		return ptm::rotate_quaternion_into_cubic_fundamental_zone(q);
-	if (type == PTM_MATCH_ICO)
-		return ptm::rotate_quaternion_into_icosahedral_fundamental_zone(q);
-
-	if (type == PTM_MATCH_HCP || type == PTM_MATCH_GRAPHENE) {
-		if (output_conventional_orientation) {
-			return ptm::rotate_quaternion_into_hcp_conventional_fundamental_zone(q);
-		} else {
-			return ptm::rotate_quaternion_into_hcp_fundamental_zone(q);
-		}
-	}
-
-	if (type == PTM_MATCH_DCUB) {
-		if (output_conventional_orientation) {
-			return ptm::rotate_quaternion_into_cubic_fundamental_zone(q);
-		} else {
-			return ptm::rotate_quaternion_into_diamond_cubic_fundamental_zone(q);
-		}
-	}
+//For each structure and orientation convention: the generators of the fundamental zone and, for
+//each generator, the permutation of the template points and the (alternative) template it maps to.
+//Indexed by [type][output_conventional_orientation].  This is the only table of the alternative
+//templates; refdata_t holds the primary template used for matching.
+typedef struct
+{
+	int num_generators;
+	const double (*generator)[4];
+	const int8_t (*mapping)[PTM_MAX_POINTS];
+	const int8_t *template_indices;		//NULL if there is a single template
+	const double (*points[4])[3];
+	const double (*penrose[4])[3];
+} orientationzone_t;
+
+#define CUBIC_ZONE(name) {NUM_CUBIC_MAPPINGS, ptm::generator_cubic, ptm::mapping_##name, NULL, {ptm_template_##name}, {ptm::penrose_##name}}
+
+static const orientationzone_t orientation_zones[PTM_MATCH_GRAPHENE + 1][2] = {
+	//PTM_MATCH_NONE
+	{{0, NULL, NULL, NULL, {NULL}, {NULL}},
+	 {0, NULL, NULL, NULL, {NULL}, {NULL}}},
+
+	{CUBIC_ZONE(fcc), CUBIC_ZONE(fcc)},
+
+	{{NUM_HEX_MAPPINGS, ptm::generator_hcp, ptm::mapping_hcp, NULL,
+	  {ptm_template_hcp}, {ptm::penrose_hcp}},
+	 {NUM_CONVENTIONAL_HEX_MAPPINGS, ptm::generator_hcp_conventional, ptm::mapping_hcp_conventional, ptm::template_indices_hcp,
+	  {ptm_template_hcp, ptm_template_hcp_alt1}, {ptm::penrose_hcp, ptm::penrose_hcp_alt1}}},
+
+	{CUBIC_ZONE(bcc), CUBIC_ZONE(bcc)},
+
+	{{NUM_ICO_MAPPINGS, ptm::generator_icosahedral, ptm::mapping_ico, NULL, {ptm_template_ico}, {ptm::penrose_ico}},
+	 {NUM_ICO_MAPPINGS, ptm::generator_icosahedral, ptm::mapping_ico, NULL, {ptm_template_ico}, {ptm::penrose_ico}}},
+
+	{CUBIC_ZONE(sc), CUBIC_ZONE(sc)},
+
+	{{NUM_DCUB_MAPPINGS, ptm::generator_diamond_cubic, ptm::mapping_dcub, NULL,
+	  {ptm_template_dcub}, {ptm::penrose_dcub}},
+	 {NUM_CONVENTIONAL_DCUB_MAPPINGS, ptm::generator_cubic, ptm::mapping_dcub_conventional, ptm::template_indices_dcub,
+	  {ptm_template_dcub, ptm_template_dcub_alt1}, {ptm::penrose_dcub, ptm::penrose_dcub_alt1}}},
+
+	{{NUM_DHEX_MAPPINGS, ptm::generator_diamond_hexagonal, ptm::mapping_dhex, NULL,
+	  {ptm_template_dhex}, {ptm::penrose_dhex}},
+	 {NUM_CONVENTIONAL_DHEX_MAPPINGS, ptm::generator_hcp_conventional, ptm::mapping_dhex_conventional, ptm::template_indices_dhex,
+	  {ptm_template_dhex, ptm_template_dhex_alt1, ptm_template_dhex_alt2, ptm_template_dhex_alt3},
+	  {ptm::penrose_dhex, ptm::penrose_dhex_alt1, ptm::penrose_dhex_alt2, ptm::penrose_dhex_alt3}}},
+
+	{{NUM_HEX_MAPPINGS, ptm::generator_hcp, ptm::mapping_graphene, NULL,
+	  {ptm_template_graphene}, {ptm::penrose_graphene}},
+	 {NUM_CONVENTIONAL_GRAPHENE_MAPPINGS, ptm::generator_hcp_conventional, ptm::mapping_graphene_conventional, ptm::template_indices_graphene,
+	  {ptm_template_graphene, ptm_template_graphene_alt1}, {ptm::penrose_graphene, ptm::penrose_graphene_alt1}}},
+};
+
+//Permutes the mapping by the bi-th generator of the zone.  Returns the index of the template the
+//mapping now refers to.
+static int permute_into_zone(const orientationzone_t* zone, int bi, int num_points, int8_t* mapping)
+{
+	int8_t temp[PTM_MAX_POINTS];
+	memset(temp, -1, PTM_MAX_POINTS * sizeof(int8_t));
 
-	if (type == PTM_MATCH_DHEX) {
-		if (output_conventional_orientation) {
-			return ptm::rotate_quaternion_into_hcp_conventional_fundamental_zone(q);
-		} else {
-			return ptm::rotate_quaternion_into_diamond_hexagonal_fundamental_zone(q);
-		}
-	}
+	const int8_t* permutation = zone->mapping[bi];
+	for (int i=0;i<num_points;i++)
+		temp[permutation[i]] = mapping[i];
+	memcpy(mapping, temp, num_points * sizeof(int8_t));
 
-	return -1;
+	return zone->template_indices != NULL ? zone->template_indices[bi] : 0;
 }
 
-static int map_quaternion(	int type,
-				bool output_conventional_orientation,
-				double *q, int i
-			)
+//Rotates q into the fundamental zone and permutes the mapping to match, in one pass.  Returns the
+//index of the template the mapping now refers to.
+static int remap_into_zone(const orientationzone_t* zone, int num_points, double* q, int8_t* mapping)
 {
-	if (type == PTM_MATCH_SC)
-		return ptm::map_quaternion_cubic(q, i);
-	if (type == PTM_MATCH_FCC)
-		return ptm::map_quaternion_cubic(q, i);
-	if (type == PTM_MATCH_BCC)
-		return ptm::map_quaternion_cubic(q, i);
-	if (type == PTM_MATCH_ICO)
-		return ptm::map_quaternion_icosahedral(q, i);
-
-	if (type == PTM_MATCH_HCP || type == PTM_MATCH_GRAPHENE) {
-		if (output_conventional_orientation) {
-			return ptm::map_quaternion_hcp_conventional(q, i);
-		} else {
-			return ptm::map_quaternion_hcp(q, i);
-		}
-	}
-
-	if (type == PTM_MATCH_DCUB) {
-		if (output_conventional_orientation) {
-			return ptm::map_quaternion_cubic(q, i);
-		} else {
-			return ptm::map_quaternion_diamond_cubic(q, i);
-		}
-	}
+	int bi = ptm::rotate_quaternion_into_fundamental_zone(zone->num_generators, zone->generator, q);
+	if (bi < 0)
+		return bi;
 
-	if (type == PTM_MATCH_DHEX) {
-		if (output_conventional_orientation) {
-			return ptm::map_quaternion_hcp_conventional(q, i);
-		} else {
-			return ptm::map_quaternion_diamond_hexagonal(q, i);
-		}
-	}
-
-	return -1;
+	return permute_into_zone(zone, bi, num_points, mapping);
 }
 
 int ptm_undo_conventional_orientation(int type, int input_template_index, double* q, int8_t* mapping)
@@ -175,15 +175,13 @@ int ptm_remap_template(	int type, bool output_conventional_orientation, int inpu
 		return -1;
 
 	const ptm::refdata_t* ref = ptm::refdata[type];
-
-	int8_t temp[PTM_MAX_POINTS];
-	memset(temp, -1, PTM_MAX_POINTS * sizeof(int8_t));
+	const orientationzone_t* zone = &orientation_zones[type][output_conventional_orientation ? 1 : 0];
 
 	int ret = ptm_undo_conventional_orientation(type, input_template_index, q, mapping);
 	if (ret != 0)
 		return -1;
 
-	int bi = 0;
+	int template_index = 0;
 	if (qtarget != NULL)
 	{
 		//argmin_g ||ag - b|| = argmin_g  ||binv.a.g - binv.b|| = argmin_g  ||binv.a.g - I||
@@ -191,49 +189,23 @@ int ptm_remap_template(	int type, bool output_conventional_orientation, int inpu
 		double invtarget[4] = {-qtarget[0], qtarget[1], qtarget[2], qtarget[3]};
 
 		ptm::quat_rot(invtarget, q, temp);
-		bi = rotate_into_fundamental_zone(type, true, temp);
+		int bi = ptm::rotate_quaternion_into_fundamental_zone(zone->num_generators, zone->generator, temp);
 		if (bi < 0)
 			return bi;
 
-		map_quaternion(type, output_conventional_orientation, q, bi);
+		ptm::map_quaternion(q, zone->generator[bi]);
 		*p_disorientation = ptm::quat_misorientation(q, qtarget);
+		template_index = permute_into_zone(zone, bi, ref->num_nbrs + 1, mapping);
 	}
 	else
 	{
-		bi = rotate_into_fundamental_zone(ref->type, output_conventional_orientation, q);
-		if (bi < 0)
-			return bi;
-	}
-
-	int template_index = 0;
-	const double (*ref_template)[3] = ref->points;
-	if (output_conventional_orientation & (    ref->type == PTM_MATCH_HCP
-						|| ref->type == PTM_MATCH_GRAPHENE
-						|| ref->type == PTM_MATCH_DCUB
-						|| ref->type == PTM_MATCH_DHEX))
-	{
-		template_index = ref->template_indices[bi];
-
-		for (int i=0;i<ref->num_nbrs+1;i++)
-			temp[ref->mapping_conventional[bi][i]] = mapping[i];
-
-		if (template_index == 1)
-			ref_template = ref->points_alt1;
-		else if (template_index == 2)
-			ref_template = ref->points_alt2;
-		else if (template_index == 3)
-			ref_template = ref->points_alt3;
-	}
-	else
-	{
-		for (int i=0;i<ref->num_nbrs+1;i++)
-			temp[ref->mapping[bi][i]] = mapping[i];
+		template_index = remap_into_zone(zone, ref->num_nbrs + 1, q, mapping);
+		if (template_index < 0)
+			return template_index;
 	}
 
-	memcpy(mapping, temp, (ref->num_nbrs + 1) * sizeof(int8_t));
-
 	if (p_best_template != NULL)
-		*p_best_template = ref_template;
+		*p_best_template = zone->points[template_index];
 
 	return template_index;
 }
@@ -254,106 +226,164 @@ static void output_data(ptm::result_t *res, ptm::atomicenv_t* env,
 	if (p_alloy_type != NULL)
 		*p_alloy_type = ptm::find_alloy_type(ref, res->mapping, env->numbers);
 
-	const double (*ref_template)[3] = NULL;
-	int best_template_index = ptm_remap_template(	ref->type, output_conventional_orientation, 0,
-							NULL, res->q, NULL, res->mapping, &ref_template);
+	if (p_rmsd != NULL)
+		*p_rmsd = res->rmsd;
+
+	if (p_scale != NULL)
+		*p_scale = res->scale;
+
+	if (p_interatomic_distance != NULL || p_lattice_constant != NULL) {
+		double interatomic_distance = calculate_interatomic_distance(ref->type, res->scale);
+		double lattice_constant = calculate_lattice_constant(ref->type, interatomic_distance);
+
+		if (p_interatomic_distance != NULL)
+			*p_interatomic_distance = interatomic_distance;
+
+		if (p_lattice_constant != NULL)
+			*p_lattice_constant = lattice_constant;
+	}
+
+	//the remaining outputs all depend on the remapped template
+	if (q == NULL && F == NULL && output_indices == NULL && p_best_template_index == NULL && p_best_template == NULL)
+		return;
+
+	const orientationzone_t* zone = &orientation_zones[ref->type][output_conventional_orientation ? 1 : 0];
+	int best_template_index = remap_into_zone(zone, ref->num_nbrs + 1, res->q, res->mapping);
 	if (best_template_index < 0)
 		return;
 
+	const double (*ref_template)[3] = zone->points[best_template_index];
+
 	if (p_best_template_index != NULL)
 		*p_best_template_index = best_template_index;
 
 	if (p_best_template != NULL)
 		*p_best_template = ref_template;
 
-	const double (*ref_penrose)[3] = ref->penrose;
-	if (output_conventional_orientation & (    ref->type == PTM_MATCH_HCP
-						|| ref->type == PTM_MATCH_GRAPHENE
-						|| ref->type == PTM_MATCH_DCUB
-						|| ref->type == PTM_MATCH_DHEX))
-	{
-		if (best_template_index == 1)
-			ref_penrose = ref->penrose_alt1;
-		else if (best_template_index == 2)
-			ref_penrose = ref->penrose_alt2;
-		else if (best_template_index == 3)
-			ref_penrose = ref->penrose_alt3;
-	}
-
-	if (F != NULL && F_res != NULL) {
-		double scaled_points[PTM_MAX_INPUT_POINTS][3];
-
-		ptm::subtract_barycentre(ref->num_nbrs + 1, env->points, scaled_points);
-		for (int i = 0; i < ref->num_nbrs + 1; i++) {
-			scaled_points[i][0] *= res->scale;
-			scaled_points[i][1] *= res->scale;
-			scaled_points[i][2] *= res->scale;
-		}
-
-		ptm::calculate_deformation_gradient(ref->num_nbrs + 1, ref_template,
-						    res->mapping, scaled_points, ref_penrose,
-						    F, F_res);
-		if (ref->type == PTM_MATCH_GRAPHENE) // hack for pseudo-2d structures
-			F[8] = 1;
-
-		if (P != NULL && U != NULL)
-			ptm::polar_decomposition_3x3(F, false, U, P);
-	}
+	if (q != NULL)
+		memcpy(q, res->q, 4 * sizeof(double));
 
 	if (output_indices != NULL)
 		for (int i = 0; i < ref->num_nbrs + 1; i++)
 			output_indices[i] = env->ordering[res->mapping[i]];
 
-	double interatomic_distance = calculate_interatomic_distance(ref->type, res->scale);
-	double lattice_constant = calculate_lattice_constant(ref->type, interatomic_distance);
+	if (F == NULL || F_res == NULL)
+		return;
 
-	if (p_interatomic_distance != NULL)
-		*p_interatomic_distance = interatomic_distance;
+	const double (*ref_penrose)[3] = zone->penrose[best_template_index];
 
-	if (p_lattice_constant != NULL)
-		*p_lattice_constant = lattice_constant;
+	double scaled_points[PTM_MAX_INPUT_POINTS][3];
 
-	*p_rmsd = res->rmsd;
-	*p_scale = res->scale;
-	memcpy(q, res->q, 4 * sizeof(double));
+	ptm::subtract_barycentre(ref->num_nbrs + 1, env->points, scaled_points);
+	for (int i = 0; i < ref->num_nbrs + 1; i++) {
+		scaled_points[i][0] *= res->scale;
+		scaled_points[i][1] *= res->scale;
+		scaled_points[i][2] *= res->scale;
+	}
+
+	ptm::calculate_deformation_gradient(ref->num_nbrs + 1, ref_template,
+					    res->mapping, scaled_points, ref_penrose,
+					    F, F_res);
+	if (ref->type == PTM_MATCH_GRAPHENE) // hack for pseudo-2d structures
+		F[8] = 1;
+
+	if (P != NULL && U != NULL)
+		ptm::polar_decomposition_3x3(F, false, U, P);
 }
 
-extern bool ptm_initialized;
+namespace ptm {
 
-int ptm_index(ptm_local_handle_t local_handle,
-              size_t atom_index, int (get_neighbours)(void* vdata, size_t _unused_lammps_variable, size_t atom_index, int num, int* ordering, size_t* nbr_indices, int32_t* numbers, double (*nbr_pos)[3]), void* nbrlist,
-	      int32_t flags,
-	      bool output_conventional_orientation, int32_t *p_type,
-	      int32_t *p_alloy_type, double *p_scale, double *p_rmsd, double *q,
-	      double *F, double *F_res, double *U, double *P,
-	      double *p_interatomic_distance, double *p_lattice_constant,
-	      int* p_best_template_index, const double (**p_best_template)[3],
-	      int8_t *output_indices)
+static int order_two_shells(	ptm_stats_t* stats, int num_inner, int num_outer, size_t atom_index,
+				int (get_neighbours)(void* vdata, size_t _unused_lammps_variable, size_t atom_index, int num, int* ordering, size_t* nbr_indices, int32_t* numbers, double (*nbr_pos)[3]), void* nbrlist,
+				const atomicenv_t* env, int num_points, atomicenv_t* output)
 {
-	int ret = 0;
-	assert(ptm_initialized);
-	if (!ptm_initialized)	//assert is not active in OVITO release build
-		return -1;
+	(void)stats;
+	PTM_STATS_START(start);
+	int ret = calculate_two_shell_neighbour_ordering(num_inner, num_outer, atom_index, get_neighbours, nbrlist, env, num_points, output);
+	PTM_STATS_STOP(stats, PTM_STAGE_NEIGHBOURS, start);
+	return ret;
+}
 
-	//-------- initialize output values with failure case --------
-	ptm::result_t res;
+//finds the points of env which are the atoms of a stored mapping; fails unless they are all among the first num_points
+static bool find_warm_mapping(int num_points, const atomicenv_t* env, int num_env, const int32_t* mapped_indices, int8_t* mapping)
+{
+	if (num_env < num_points)
+		return false;
+
+	for (int i=0;i<num_points;i++)
+	{
+		int found = -1;
+		for (int j=0;j<num_points && found < 0;j++)
+			if (env->nbr_indices[j] == (size_t)mapped_indices[i])
+				found = j;
+
+		if (found < 0)
+			return false;
+		mapping[i] = found;
+	}
+
+	return true;
+}
+
+int index_atom(	ptm_stats_t* stats, size_t atom_index, int num_points, atomicenv_t* env,
+		int (get_neighbours)(void* vdata, size_t _unused_lammps_variable, size_t atom_index, int num, int* ordering, size_t* nbr_indices, int32_t* numbers, double (*nbr_pos)[3]), void* nbrlist,
+		int32_t flags, bool output_conventional_orientation, double max_rmsd, warmatom_t* warm, double guard_rmsd,
+		int32_t* p_type, int32_t* p_alloy_type, double* p_scale, double* p_rmsd, double* q, double* F, double* F_res, double* U, double* P, double* p_interatomic_distance, double* p_lattice_constant,
+		int* p_best_template_index, const double (**p_best_template)[3], int8_t* output_indices)
+{
+	result_t res;
 	res.ref_struct = NULL;
-	res.rmsd = INFINITY;
+	res.rmsd = max_rmsd;		//mappings which cannot beat this are rejected before their rotation is found
+	res.stats = stats;
+	PTM_STATS_COUNT(stats, num_atoms);
+
+	//the two-shell orderings are found at most once, when first needed
+	atomicenv_t dmn_env, grp_env;
+	const int not_ordered = 1;
+	int dmn_ret = not_ordered, grp_ret = not_ordered;
+
+	//the environment of the central atom is gathered once and shared by all matchers
+	bool single_shell = flags & (PTM_CHECK_SC | PTM_CHECK_FCC | PTM_CHECK_HCP | PTM_CHECK_ICO | PTM_CHECK_BCC);
+	if (!single_shell && (flags & (PTM_CHECK_DCUB | PTM_CHECK_DHEX | PTM_CHECK_GRAPHENE))) {
+		PTM_STATS_START(start);
+		num_points = get_neighbours(nbrlist, -1, atom_index, PTM_MAX_INPUT_POINTS, env->ordering, env->nbr_indices, env->numbers, env->points);
+		PTM_STATS_STOP(stats, PTM_STAGE_NEIGHBOURS, start);
+	}
 
-	if (output_indices != NULL)
-		memset(output_indices, -1, PTM_MAX_INPUT_POINTS * sizeof(int8_t));
+	//PTM_CHECK_X is 1 << (PTM_MATCH_X - 1) for every structure type
+	bool reused = false;
+	if (warm != NULL && warm->type != PTM_MATCH_NONE && (flags & (1 << (warm->type - 1)))) {
+
+		const refdata_t* ref = refdata[warm->type];
+		atomicenv_t* warm_env = env;
+		int num_warm = num_points;
+		if (ref->type == PTM_MATCH_DCUB || ref->type == PTM_MATCH_DHEX) {
+			dmn_ret = order_two_shells(stats, 4, 3, atom_index, get_neighbours, nbrlist, env, num_points, &dmn_env);
+			warm_env = &dmn_env;
+			num_warm = dmn_ret == 0 ? PTM_NUM_NBRS_DCUB + 1 : 0;
+		}
+		else if (ref->type == PTM_MATCH_GRAPHENE) {
+			grp_ret = order_two_shells(stats, 3, 2, atom_index, get_neighbours, nbrlist, env, num_points, &grp_env);
+			warm_env = &grp_env;
+			num_warm = grp_ret == 0 ? PTM_NUM_NBRS_GRAPHENE + 1 : 0;
+		}
 
-	*p_type = PTM_MATCH_NONE;
-	if (p_alloy_type != NULL)
-		*p_alloy_type = PTM_ALLOY_NONE;
-	//------------------------------------------------------------
+		int8_t mapping[PTM_MAX_POINTS];
+		if (find_warm_mapping(ref->num_nbrs + 1, warm_env, num_warm, warm->mapped_indices, mapping)) {
+			res.rmsd = std::min(max_rmsd, guard_rmsd);
+			reused = match_mapping(ref, warm_env->points, mapping, &res);
+		}
 
-	ptm::atomicenv_t env, dmn_env, grp_env;
+		if (!reused) {
+			res.ref_struct = NULL;
+			res.rmsd = max_rmsd;
+		}
+	}
 
-	ptm::convexhull_t ch;
+	convexhull_t ch;
 	double ch_points[PTM_MAX_INPUT_POINTS][3];
 
-	if (flags & (PTM_CHECK_SC | PTM_CHECK_FCC | PTM_CHECK_HCP | PTM_CHECK_ICO | PTM_CHECK_BCC)) {
+	if (!reused && single_shell) {
 
 		int min_points = PTM_NUM_POINTS_SC;
 		if (flags & (PTM_CHECK_FCC | PTM_CHECK_HCP | PTM_CHECK_ICO))
@@ -361,60 +391,120 @@ int ptm_index(ptm_local_handle_t local_handle,
 		if (flags & PTM_CHECK_BCC)
 			min_points = PTM_NUM_POINTS_BCC;
 
-		int num_points = get_neighbours(nbrlist, -1, atom_index, PTM_MAX_INPUT_POINTS, env.ordering, env.nbr_indices, env.numbers, env.points);
-		if (num_points < min_points)
+		if (num_points < min_points) {
+			if (warm != NULL)
+				warm->type = PTM_MATCH_NONE;
 			return -1;
+		}
 
-		ptm::normalize_vertices(num_points, env.points, ch_points);
+		normalize_vertices(num_points, env->points, ch_points);
 		ch.ok = false;
 
 		if (flags & PTM_CHECK_SC)
-			ret = match_general(&ptm::structure_sc, ch_points, env.points, &ch, &res);
+			match_general(&structure_sc, ch_points, env->points, flags, &ch, &res);
 
 		if (flags & (PTM_CHECK_FCC | PTM_CHECK_HCP | PTM_CHECK_ICO))
-			ret = match_fcc_hcp_ico(ch_points, env.points, flags, &ch, &res);
+			match_fcc_hcp_ico(ch_points, env->points, flags, &ch, &res);
 
 		if (flags & PTM_CHECK_BCC)
-			ret = match_general(&ptm::structure_bcc, ch_points, env.points, &ch, &res);
+			match_general(&structure_bcc, ch_points, env->points, flags, &ch, &res);
 	}
 
-	if (flags & (PTM_CHECK_DCUB | PTM_CHECK_DHEX)) {
+	if (!reused && (flags & (PTM_CHECK_DCUB | PTM_CHECK_DHEX))) {
 
-		const int num_inner = 4, num_outer = 3;
+		if (dmn_ret == not_ordered)
+			dmn_ret = order_two_shells(stats, 4, 3, atom_index, get_neighbours, nbrlist, env, num_points, &dmn_env);
 
-		ret = ptm::calculate_two_shell_neighbour_ordering(num_inner, num_outer, atom_index, get_neighbours, nbrlist, &dmn_env);
-
-		if (ret == 0) {
-			ptm::normalize_vertices(PTM_NUM_NBRS_DCUB + 1, dmn_env.points, ch_points);
+		if (dmn_ret == 0) {
+			normalize_vertices(PTM_NUM_NBRS_DCUB + 1, dmn_env.points, ch_points);
 			ch.ok = false;
 
-			ret = match_dcub_dhex(ch_points, dmn_env.points, flags, &ch, &res);
+			match_dcub_dhex(ch_points, dmn_env.points, flags, &ch, &res);
 		}
 	}
 
-	if (flags & PTM_CHECK_GRAPHENE) {
+	if (!reused && (flags & PTM_CHECK_GRAPHENE)) {
 
-		const int num_inner = 3, num_outer = 2;
+		if (grp_ret == not_ordered)
+			grp_ret = order_two_shells(stats, 3, 2, atom_index, get_neighbours, nbrlist, env, num_points, &grp_env);
 
-		ret = ptm::calculate_two_shell_neighbour_ordering(num_inner, num_outer, atom_index, get_neighbours, nbrlist, &grp_env);
-		if (ret == 0) {
-			ret = match_graphene(grp_env.points, &res);
+		if (grp_ret == 0) {
+			match_graphene(grp_env.points, &res);
 		}
 	}
 
-	if (res.ref_struct == NULL)
+	if (res.ref_struct == NULL) {
+		if (warm != NULL)
+			warm->type = PTM_MATCH_NONE;
 		return PTM_NO_ERROR;
+	}
 
-	ptm::atomicenv_t* res_env = &env;
+	atomicenv_t* res_env = env;
 	if (res.ref_struct->type == PTM_MATCH_DCUB || res.ref_struct->type == PTM_MATCH_DHEX)
 		res_env = &dmn_env;
 	else if (res.ref_struct->type == PTM_MATCH_GRAPHENE)
 		res_env = &grp_env;
 
+	//the mapping is stored by atom index, since the order of the neighbours can change between frames
+	if (warm != NULL) {
+		warm->type = res.ref_struct->type;
+		for (int i=0;i<res.ref_struct->num_nbrs+1;i++)
+			warm->mapped_indices[i] = (int32_t)res_env->nbr_indices[res.mapping[i]];
+	}
+
+	if (reused)
+		PTM_STATS_COUNT(stats, num_reused);
+
+	PTM_STATS_COUNT(stats, num_matched);
+	PTM_STATS_START(output_start);
 	output_data(	&res, res_env, output_conventional_orientation, p_type, p_alloy_type, p_scale,
 			p_rmsd, q, F, F_res, U, P, p_interatomic_distance,
 			p_lattice_constant, p_best_template_index, p_best_template, output_indices);
+	PTM_STATS_STOP(stats, PTM_STAGE_OUTPUT, output_start);
 
 	return PTM_NO_ERROR;
 }
 
+}
+
+int ptm_index(ptm_local_handle_t local_handle,
+              size_t atom_index, int (get_neighbours)(void* vdata, size_t _unused_lammps_variable, size_t atom_index, int num, int* ordering, size_t* nbr_indices, int32_t* numbers, double (*nbr_pos)[3]), void* nbrlist,
+	      int32_t flags,
+	      bool output_conventional_orientation, double max_rmsd, int32_t *p_type,
+	      int32_t *p_alloy_type, double *p_scale, double *p_rmsd, double *q,
+	      double *F, double *F_res, double *U, double *P,
+	      double *p_interatomic_distance, double *p_lattice_constant,
+	      int* p_best_template_index, const double (**p_best_template)[3],
+	      int8_t *output_indices)
+{
+	assert(ptm::initialized);
+	if (!ptm::initialized)	//assert is not active in OVITO release build
+		return -1;
+
+	//-------- initialize output values with failure case --------
+	if (output_indices != NULL)
+		memset(output_indices, -1, PTM_MAX_INPUT_POINTS * sizeof(int8_t));
+
+	*p_type = PTM_MATCH_NONE;
+	if (p_alloy_type != NULL)
+		*p_alloy_type = PTM_ALLOY_NONE;
+	//------------------------------------------------------------
+
+	ptm::atomicenv_t env;
+
+	ptm_stats_t* stats = ptm::local_stats(local_handle);
+
+	int num_points = 0;
+	if (flags & (PTM_CHECK_SC | PTM_CHECK_FCC | PTM_CHECK_HCP | PTM_CHECK_ICO | PTM_CHECK_BCC))
+	{
+		PTM_STATS_START(start);
+		num_points = get_neighbours(nbrlist, -1, atom_index, PTM_MAX_INPUT_POINTS, env.ordering, env.nbr_indices, env.numbers, env.points);
+		PTM_STATS_STOP(stats, PTM_STAGE_NEIGHBOURS, start);
+	}
+
+	return ptm::index_atom(	stats, atom_index, num_points, &env, get_neighbours, nbrlist,
+				flags, output_conventional_orientation, max_rmsd, NULL, 0,
+				p_type, p_alloy_type, p_scale, p_rmsd, q, F, F_res, U, P,
+				p_interatomic_distance, p_lattice_constant,
+				p_best_template_index, p_best_template, output_indices);
+}
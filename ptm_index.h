@@ -0,0 +1,49 @@
+/*Copyright (c) 2016 PM Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef PTM_INDEX_H
+#define PTM_INDEX_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ptm_constants.h"
+#include "ptm_functions.h"
+#include "ptm_multishell.h"
+
+namespace ptm {
+
+//the match of an atom in a previous frame: its structure and the atom mapped to each template point
+typedef struct
+{
+	int32_t type;				//PTM_MATCH_NONE if nothing is stored
+	int32_t mapped_indices[PTM_MAX_POINTS];
+} warmatom_t;
+
+//Indexes a single atom.  When any of the single-shell structures (SC, FCC, HCP, ICO, BCC) are
+//requested, the caller must have gathered the nearest neighbours of the atom into env, with
+//num_points set to the number of points gathered (central atom included); otherwise env is
+//filled here.  The two-shell structures (DCUB, DHEX, graphene) reuse env for the central atom
+//and gather the environments of its inner neighbours through get_neighbours.
+//Output values are only written if a match is found; initializing them is the caller's job.
+//Any output other than p_type may be NULL, in which case the work needed for it is skipped.
+//Templates are only matched if their RMSD is below max_rmsd (INFINITY to accept any match).
+//Statistics are added to stats unless it is NULL.
+//If warm is not NULL, the match it holds is tried first: when the atoms it maps are still the
+//nearest neighbours and the mapping has an RMSD below guard_rmsd, it is used without matching
+//any templates.  warm is then updated with the match found (or cleared).
+int index_atom(	ptm_stats_t* stats, size_t atom_index, int num_points, atomicenv_t* env,
+		int (get_neighbours)(void* vdata, size_t _unused_lammps_variable, size_t atom_index, int num, int* ordering, size_t* nbr_indices, int32_t* numbers, double (*nbr_pos)[3]), void* nbrlist,
+		int32_t flags, bool output_conventional_orientation, double max_rmsd, warmatom_t* warm, double guard_rmsd,
+		int32_t* p_type, int32_t* p_alloy_type, double* p_scale, double* p_rmsd, double* q, double* F, double* F_res, double* U, double* P, double* p_interatomic_distance, double* p_lattice_constant,
+		int* p_best_template_index, const double (**p_best_template)[3], int8_t* output_indices);
+
+}
+
+#endif
+
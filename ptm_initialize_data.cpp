@@ -15,66 +15,70 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <cassert>
 #include <algorithm>
 #include "ptm_initialize_data.h"
+#include "ptm_graph_index.h"
+#include "ptm_stats.h"
 
 
-static void make_facets_clockwise(int num_facets, int8_t (*facets)[3], const double (*points)[3])
+static bool graphentry_compare(ptm::graphentry_t const& a, ptm::graphentry_t const& b)
 {
-        double plane_normal[3];
-        double origin[3] = {0, 0, 0};
-
-        for (int i = 0;i<num_facets;i++)
-                ptm::add_facet(points, facets[i][0], facets[i][1], facets[i][2], facets[i], plane_normal, origin);
+        return a.hash < b.hash;
 }
 
-static int initialize_graphs(const ptm::refdata_t* s, int8_t* colours)
-{
-        for (int i = 0;i<s->num_graphs;i++)
-        {
-                int8_t code[2 * PTM_MAX_EDGES];
-                int8_t degree[PTM_MAX_NBRS];
-                int _max_degree = ptm::graph_degree(s->num_facets, s->graphs[i].facets, s->num_nbrs, degree);
-                assert(_max_degree <= s->max_degree);
+namespace ptm {
 
-                make_facets_clockwise(s->num_facets, s->graphs[i].facets, &s->points[1]);
-                int ret = ptm::canonical_form_coloured(s->num_facets, s->graphs[i].facets, s->num_nbrs, degree, colours, s->graphs[i].canonical_labelling, (int8_t*)&code[0], &s->graphs[i].hash);
-                if (ret != 0)
-                        return ret;
-        }
+//Finds the graphs, of any structure, with a given canonical hash.
+int find_graphs(uint64_t hash, const graphentry_t** p_entries)
+{
+        graphentry_t key;
+        key.hash = hash;
+        std::pair<const graphentry_t*, const graphentry_t*> range = std::equal_range(graph_entries, graph_entries + PTM_NUM_GRAPHS, key, &graphentry_compare);
+        *p_entries = range.first;
+        return range.second - range.first;
+}
 
-        return PTM_NO_ERROR;
 }
 
+//All template data is constant, so there is nothing left to initialize at runtime.  The flags only
+//record that the caller has followed the initialization protocol.  The library checks the atomic
+//flag; the plain flag is kept for C callers and is written once, by the first caller.
+std::atomic<bool> ptm::initialized(false);
 bool ptm_initialized = false;
 int ptm_initialize_global()
 {
-        if (ptm_initialized)
-                return PTM_NO_ERROR;
-
-        int8_t colours[PTM_MAX_POINTS] = {0};
-        int8_t dcolours[PTM_MAX_POINTS] = {1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
-
-        int ret = initialize_graphs(&ptm::structure_sc, colours);
-        ret |= initialize_graphs(&ptm::structure_fcc, colours);
-        ret |= initialize_graphs(&ptm::structure_hcp, colours);
-        ret |= initialize_graphs(&ptm::structure_ico, colours);
-        ret |= initialize_graphs(&ptm::structure_bcc, colours);
-        ret |= initialize_graphs(&ptm::structure_dcub, dcolours);
-        ret |= initialize_graphs(&ptm::structure_dhex, dcolours);
-
-        if (ret == PTM_NO_ERROR)
+        if (!ptm::initialized.exchange(true))
                 ptm_initialized = true;
-
-        return ret;
+        return PTM_NO_ERROR;
 }
 
 ptm_local_handle_t ptm_initialize_local()
 {
-        assert(ptm_initialized);
-        return (ptm_local_handle_t)ptm::voronoi_initialize_local();
+        assert(ptm::initialized);
+        ptm_local_handle_t ptr = new ptm_local_handle;
+        ptr->voronoi_handle = ptm::voronoi_initialize_local();
+        memset(&ptr->stats, 0, sizeof(ptm_stats_t));
+        return ptr;
 }
 
 void ptm_uninitialize_local(ptm_local_handle_t ptr)
 {
-        ptm::voronoi_uninitialize_local(ptr);
+        ptm::voronoi_uninitialize_local(ptr->voronoi_handle);
+        delete ptr;
+}
+
+int ptm_get_stats(ptm_local_handle_t local_handle, ptm_stats_t* stats)
+{
+#ifdef PTM_ENABLE_STATS
+        memcpy(stats, &local_handle->stats, sizeof(ptm_stats_t));
+        return PTM_NO_ERROR;
+#else
+        (void)local_handle;
+        memset(stats, 0, sizeof(ptm_stats_t));
+        return -1;
+#endif
+}
+
+void ptm_reset_stats(ptm_local_handle_t local_handle)
+{
+        memset(&local_handle->stats, 0, sizeof(ptm_stats_t));
 }
 
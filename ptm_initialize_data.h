@@ -11,6 +11,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #define PTM_INITIALIZE_DATA_H
 
 
+#include <atomic>
 #include "ptm_graph_data.h"
 #include "ptm_graph_tools.h"
 #include "ptm_deformation_gradient.h"
@@ -31,15 +32,9 @@ typedef struct
 	int num_facets;
 	int max_degree;
 	int num_graphs;
-	graph_t* graphs;
+	const graph_t* graphs;
 	const double (*points)[3];
-	const double (*points_alt1)[3];
-	const double (*points_alt2)[3];
-	const double (*points_alt3)[3];
 	const double (*penrose)[3];
-	const double (*penrose_alt1)[3];
-	const double (*penrose_alt2)[3];
-	const double (*penrose_alt3)[3];
 	int num_mappings;
 	const int8_t (*mapping)[PTM_MAX_POINTS];
 	int num_conventional_mappings;
@@ -57,13 +52,7 @@ const refdata_t structure_sc = {	PTM_MATCH_SC,			//.type
 					NUM_SC_GRAPHS,			//.num_graphs
 					graphs_sc,			//.graphs
 					ptm_template_sc,		//.points
-					NULL,				//.points_alt1
-					NULL,				//.points_alt2
-					NULL,				//.points_alt3
 					penrose_sc,			//.penrose
-					NULL,				//.penrose_alt1
-					NULL,				//.penrose_alt2
-					NULL,				//.penrose_alt3
 					NUM_CUBIC_MAPPINGS,		//.num_mappings
 					mapping_sc,			//.mapping
 					0,				//.num_conventional_mappings
@@ -80,13 +69,7 @@ const refdata_t structure_fcc = {	PTM_MATCH_FCC,			//.type
 					NUM_FCC_GRAPHS,			//.num_graphs
 					graphs_fcc,			//.graphs
 					ptm_template_fcc,		//.points
-					NULL,				//.points_alt1
-					NULL,				//.points_alt2
-					NULL,				//.points_alt3
 					penrose_fcc,			//.penrose
-					NULL,				//.penrose_alt1
-					NULL,				//.penrose_alt2
-					NULL,				//.penrose_alt3
 					NUM_CUBIC_MAPPINGS,		//.num_mappings
 					mapping_fcc,			//.mapping
 					0,				//.num_conventional_mappings
@@ -103,13 +86,7 @@ const refdata_t structure_hcp = {	PTM_MATCH_HCP,				//.type
 					NUM_HCP_GRAPHS,				//.num_graphs
 					graphs_hcp,				//.graphs
 					ptm_template_hcp,			//.points
-					ptm_template_hcp_alt1,			//.points_alt1
-					NULL,					//.points_alt2
-					NULL,					//.points_alt3
 					penrose_hcp,				//.penrose
-					penrose_hcp_alt1,			//.penrose_alt1
-					NULL,					//.penrose_alt2
-					NULL,					//.penrose_alt3
 					NUM_HEX_MAPPINGS,			//.num_mappings
 					mapping_hcp,				//.mapping
 					NUM_CONVENTIONAL_HEX_MAPPINGS,		//.num_conventional_mappings
@@ -126,13 +103,7 @@ const refdata_t structure_ico = {	PTM_MATCH_ICO,			//.type
 					NUM_ICO_GRAPHS,			//.num_graphs
 					graphs_ico,			//.graphs
 					ptm_template_ico,		//.points
-					NULL,				//.points_alt1
-					NULL,				//.points_alt2
-					NULL,				//.points_alt3
 					penrose_ico,			//.penrose
-					NULL,				//.penrose_alt1
-					NULL,				//.penrose_alt2
-					NULL,				//.penrose_alt3
 					NUM_ICO_MAPPINGS,		//.num_mappings
 					mapping_ico,			//.mapping
 					0,				//.num_conventional_mappings
@@ -149,13 +120,7 @@ const refdata_t structure_bcc = {	PTM_MATCH_BCC,			//.type
 					NUM_BCC_GRAPHS,			//.num_graphs
 					graphs_bcc,			//.graphs
 					ptm_template_bcc,		//.points
-					NULL,				//.points_alt1
-					NULL,				//.points_alt2
-					NULL,				//.points_alt3
 					penrose_bcc,			//.penrose
-					NULL,				//.penrose_alt1
-					NULL,				//.penrose_alt2
-					NULL,				//.penrose_alt3
 					NUM_CUBIC_MAPPINGS,		//.num_mappings
 					mapping_bcc,			//.mapping
 					0,				//.num_conventional_mappings
@@ -172,13 +137,7 @@ const refdata_t structure_dcub = {	PTM_MATCH_DCUB,				//.type
 					NUM_DCUB_GRAPHS,			//.num_graphs
 					graphs_dcub,				//.graphs
 					ptm_template_dcub,			//.points
-					ptm_template_dcub_alt1,			//.points_alt1
-					NULL,					//.points_alt2
-					NULL,					//.points_alt3
 					penrose_dcub,				//.penrose
-					penrose_dcub_alt1,			//.penrose_alt1
-					NULL,					//.penrose_alt2
-					NULL,					//.penrose_alt3
 					NUM_DCUB_MAPPINGS,			//.num_mappings
 					mapping_dcub,				//.mapping
 					NUM_CONVENTIONAL_DCUB_MAPPINGS,		//.num_conventional_mappings
@@ -195,13 +154,7 @@ const refdata_t structure_dhex = {	PTM_MATCH_DHEX,				//.type
 					NUM_DHEX_GRAPHS,			//.num_graphs
 					graphs_dhex,				//.graphs
 					ptm_template_dhex,			//.points
-					ptm_template_dhex_alt1,			//.points_alt1
-					ptm_template_dhex_alt2,			//.points_alt2
-					ptm_template_dhex_alt3,			//.points_alt3
 					penrose_dhex,				//.penrose
-					penrose_dhex_alt1,			//.penrose_alt1
-					penrose_dhex_alt2,			//.penrose_alt2
-					penrose_dhex_alt3,			//.penrose_alt3
 					NUM_DHEX_MAPPINGS,			//.num_mappings
 					mapping_dhex,				//.mapping
 					NUM_CONVENTIONAL_DHEX_MAPPINGS,		//.num_conventional_mappings
@@ -218,13 +171,7 @@ const refdata_t structure_graphene = {	PTM_MATCH_GRAPHENE,			//.type
 					-1,					//.num_graphs
 					NULL,					//.graphs
 					ptm_template_graphene,			//.points
-					ptm_template_graphene_alt1,		//.points_alt1
-					NULL,					//.points_alt2
-					NULL,					//.points_alt3
 					penrose_graphene,			//.penrose
-					penrose_graphene_alt1,			//.penrose_alt1
-					NULL,					//.penrose_alt2
-					NULL,					//.penrose_alt3
 					-1,					//.num_mappings
 					mapping_graphene,			//.mapping
 					NUM_CONVENTIONAL_GRAPHENE_MAPPINGS,	//.num_conventional_mappings
@@ -243,6 +190,21 @@ const refdata_t* const refdata[] = {	NULL,
 					&structure_dcub,
 					&structure_dhex,
 					&structure_graphene	};
+
+//------------------------------------
+//    graphs of all structures, sorted by canonical hash
+//------------------------------------
+typedef struct
+{
+	uint64_t hash;
+	const refdata_t* ref;
+	const graph_t* graph;
+} graphentry_t;
+
+int find_graphs(uint64_t hash, const graphentry_t** p_entries);
+
+//set by ptm_initialize_global, which may be called by several threads at once
+extern std::atomic<bool> initialized;
 }
 
 #ifdef __cplusplus
@@ -0,0 +1,159 @@
+/*Copyright (c) 2016 PM Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <algorithm>
+#include "ptm_multi_rmsd.h"
+
+
+//Compiles the kernels for several instruction sets and picks one at load time, on platforms
+//which support it.  The loops over lanes are written so that the compiler vectorizes them.
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__linux__) && !defined(PTM_NO_TARGET_CLONES)
+#define PTM_TARGET_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#define PTM_ALWAYS_INLINE __attribute__((always_inline))
+#else
+#define PTM_TARGET_CLONES
+#define PTM_ALWAYS_INLINE
+#endif
+
+namespace ptm {
+
+//Computes the inner product matrices and the largest QCP eigenvalues of up to L mappings of the
+//same points, with one mapping per lane, in precision T.
+template <typename T, int L>
+static inline PTM_ALWAYS_INLINE void inner_product_eigenvalue_lanes(        int num_points, const double (*ideal_points)[3], double (*normalized)[3],
+                                                                        int num_mappings, int8_t (*mappings)[PTM_MAX_POINTS], double E0,
+                                                                        T (*S)[L], T* lambda)
+{
+        const T evalprec = sizeof(T) == sizeof(float) ? 1e-6 : 1e-11;
+
+        for (int k=0;k<9;k++)
+                for (int l=0;l<L;l++)
+                        S[k][l] = 0;
+
+        for (int i=0;i<num_points;i++)
+        {
+                //unused lanes take the identity mapping, and their results are discarded
+                T y[3][L];
+                for (int l=0;l<L;l++)
+                {
+                        int m = l < num_mappings ? mappings[l][i] : i;
+                        y[0][l] = normalized[m][0];
+                        y[1][l] = normalized[m][1];
+                        y[2][l] = normalized[m][2];
+                }
+
+                for (int a=0;a<3;a++)
+                {
+                        T x = ideal_points[i][a];
+                        for (int b=0;b<3;b++)
+                                for (int l=0;l<L;l++)
+                                        S[a * 3 + b][l] += x * y[b][l];
+                }
+        }
+
+        T C0[L], C1[L], C2[L];
+        for (int l=0;l<L;l++)
+        {
+                T        Sxx = S[0][l], Sxy = S[1][l], Sxz = S[2][l],
+                        Syx = S[3][l], Syy = S[4][l], Syz = S[5][l],
+                        Szx = S[6][l], Szy = S[7][l], Szz = S[8][l];
+
+                T        Sxx2 = Sxx * Sxx, Syy2 = Syy * Syy, Szz2 = Szz * Szz,
+                        Sxy2 = Sxy * Sxy, Syz2 = Syz * Syz, Sxz2 = Sxz * Sxz,
+                        Syx2 = Syx * Syx, Szy2 = Szy * Szy, Szx2 = Szx * Szx;
+
+                T fnorm_squared = Sxx2 + Syy2 + Szz2 + Sxy2 + Syz2 + Sxz2 + Syx2 + Szy2 + Szx2;
+
+                T SyzSzymSyySzz2 = 2 * (Syz * Szy - Syy * Szz);
+                T Sxx2Syy2Szz2Syz2Szy2 = Syy2 + Szz2 - Sxx2 + Syz2 + Szy2;
+                T SxzpSzx = Sxz + Szx;
+                T SyzpSzy = Syz + Szy;
+                T SxypSyx = Sxy + Syx;
+                T SyzmSzy = Syz - Szy;
+                T SxzmSzx = Sxz - Szx;
+                T SxymSyx = Sxy - Syx;
+                T SxxpSyy = Sxx + Syy;
+                T SxxmSyy = Sxx - Syy;
+                T Sxy2Sxz2Syx2Szx2 = Sxy2 + Sxz2 - Syx2 - Szx2;
+
+                C0[l] = Sxy2Sxz2Syx2Szx2 * Sxy2Sxz2Syx2Szx2
+                         + (Sxx2Syy2Szz2Syz2Szy2 + SyzSzymSyySzz2) * (Sxx2Syy2Szz2Syz2Szy2 - SyzSzymSyySzz2)
+                         + (-(SxzpSzx)*(SyzmSzy)+(SxymSyx)*(SxxmSyy-Szz)) * (-(SxzmSzx)*(SyzpSzy)+(SxymSyx)*(SxxmSyy+Szz))
+                         + (-(SxzpSzx)*(SyzpSzy)-(SxypSyx)*(SxxpSyy-Szz)) * (-(SxzmSzx)*(SyzmSzy)-(SxypSyx)*(SxxpSyy+Szz))
+                         + (+(SxypSyx)*(SyzpSzy)+(SxzpSzx)*(SxxmSyy+Szz)) * (-(SxymSyx)*(SyzmSzy)+(SxzpSzx)*(SxxpSyy+Szz))
+                         + (+(SxypSyx)*(SyzmSzy)+(SxzmSzx)*(SxxmSyy-Szz)) * (-(SxymSyx)*(SyzpSzy)+(SxzmSzx)*(SxxpSyy-Szz));
+
+                C1[l] = 8 * (Sxx*Syz*Szy + Syy*Szx*Sxz + Szz*Sxy*Syx - Sxx*Syy*Szz - Syz*Szx*Sxy - Szy*Syx*Sxz);
+                C2[l] = -2 * fnorm_squared;
+        }
+
+        //Newton-Raphson, continued until every lane has converged
+        int active[L];
+        for (int l=0;l<L;l++)
+        {
+                lambda[l] = E0 > evalprec ? E0 : 0;
+                active[l] = E0 > evalprec;
+        }
+
+        for (int i=0;i<50;i++)
+        {
+                int num_active = 0;
+                for (int l=0;l<L;l++)
+                {
+                        T x = lambda[l];
+                        T x2 = x * x;
+                        T b = (x2 + C2[l]) * x;
+                        T a = b + C1[l];
+                        T delta = ((a * x + C0[l]) / (2 * x2 * x + b + a));
+                        T next = x - delta;
+                        int converged = fabs(next - x) < fabs(evalprec * next);
+
+                        lambda[l] = active[l] ? next : x;
+                        active[l] = active[l] & !converged;
+                        num_active += active[l];
+                }
+
+                if (num_active == 0)
+                        break;
+        }
+}
+
+//Gives the same results as InnerProduct followed by FastCalcMaxEigenvalue for each mapping.
+PTM_TARGET_CLONES
+void multi_inner_product_eigenvalue(        int num_points, const double (*ideal_points)[3], double (*normalized)[3],
+                                        int num_mappings, int8_t (*mappings)[PTM_MAX_POINTS], double E0,
+                                        double (*A)[9], double* eigenvalues)
+{
+        double S[9][PTM_NUM_LANES], lambda[PTM_NUM_LANES];
+        inner_product_eigenvalue_lanes<double, PTM_NUM_LANES>(num_points, ideal_points, normalized, num_mappings, mappings, E0, S, lambda);
+
+        for (int l=0;l<num_mappings;l++)
+        {
+                for (int k=0;k<9;k++)
+                        A[l][k] = S[k][l];
+                eigenvalues[l] = lambda[l];
+        }
+}
+
+//Single precision estimates of the eigenvalues, with twice as many lanes per vector.
+PTM_TARGET_CLONES
+void multi_eigenvalue_float(        int num_points, const double (*ideal_points)[3], double (*normalized)[3],
+                                int num_mappings, int8_t (*mappings)[PTM_MAX_POINTS], double E0,
+                                double* eigenvalues)
+{
+        float S[9][PTM_NUM_FLOAT_LANES], lambda[PTM_NUM_FLOAT_LANES];
+        inner_product_eigenvalue_lanes<float, PTM_NUM_FLOAT_LANES>(num_points, ideal_points, normalized, num_mappings, mappings, E0, S, lambda);
+
+        for (int l=0;l<num_mappings;l++)
+                eigenvalues[l] = lambda[l];
+}
+
+}
+
@@ -0,0 +1,32 @@
+/*Copyright (c) 2016 PM Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef PTM_MULTI_RMSD_H
+#define PTM_MULTI_RMSD_H
+
+#include <stdint.h>
+#include "ptm_constants.h"
+
+#define PTM_NUM_LANES 4
+#define PTM_NUM_FLOAT_LANES 8
+
+namespace ptm {
+
+void multi_inner_product_eigenvalue(        int num_points, const double (*ideal_points)[3], double (*normalized)[3],
+                                        int num_mappings, int8_t (*mappings)[PTM_MAX_POINTS], double E0,
+                                        double (*A)[9], double* eigenvalues);
+
+void multi_eigenvalue_float(        int num_points, const double (*ideal_points)[3], double (*normalized)[3],
+                                int num_mappings, int8_t (*mappings)[PTM_MAX_POINTS], double E0,
+                                double* eigenvalues);
+
+}
+
+#endif
+
@@ -14,7 +14,6 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <cstring>
 #include <cassert>
 #include <algorithm>
-#include <unordered_set>
 #include <cstdint>
 #include "ptm_constants.h"
 #include "ptm_voronoi_cell.h"
@@ -32,52 +31,81 @@ typedef struct
 	size_t atom_index;
 	int32_t number;
 	double offset[3];
-} sorthelper_t;
+} shellhelper_t;
 
-static bool sorthelper_compare(sorthelper_t const& a, sorthelper_t const& b)
+#define MAX_INNER 4
+
+static bool shellhelper_compare(shellhelper_t const& a, shellhelper_t const& b)
 {
 	return a.rank < b.rank;
 }
 
-#define MAX_INNER 4
+//atoms taken by the output so far: at most 1 + MAX_INNER + MAX_INNER * num_outer,
+//which is few enough that a linear search beats hashing
+typedef struct
+{
+	int num;
+	size_t indices[PTM_MAX_INPUT_POINTS];
+} claimedset_t;
+
+static bool is_claimed(const claimedset_t* claimed, size_t key)
+{
+	for (int i=0;i<claimed->num;i++)
+		if (claimed->indices[i] == key)
+			return true;
+
+	return false;
+}
+
+static void claim(claimedset_t* claimed, size_t key)
+{
+	assert(claimed->num < PTM_MAX_INPUT_POINTS);
+	claimed->indices[claimed->num++] = key;
+}
 
 int calculate_two_shell_neighbour_ordering(	int num_inner, int num_outer,
 						size_t atom_index, int (get_neighbours)(void* vdata, size_t _unused_lammps_variable, size_t atom_index, int num, int* ordering, size_t* nbr_indices, int32_t* numbers, double (*nbr_pos)[3]), void* nbrlist,
-						ptm::atomicenv_t* output)
+						const ptm::atomicenv_t* central, int num_central, ptm::atomicenv_t* output)
 {
 	assert(num_inner <= MAX_INNER);
+	assert(1 + num_inner + num_inner * num_outer <= PTM_MAX_INPUT_POINTS);
+
+	ptm::atomicenv_t gathered;
+	int num_input_points = num_central;
+	if (central == NULL)
+	{
+		num_input_points = get_neighbours(nbrlist, -1, atom_index, PTM_MAX_INPUT_POINTS, gathered.ordering, gathered.nbr_indices, gathered.numbers, gathered.points);
+		central = &gathered;
+	}
 
-	ptm::atomicenv_t central;
-	int num_input_points = get_neighbours(nbrlist, -1, atom_index, PTM_MAX_INPUT_POINTS, central.ordering, central.nbr_indices, central.numbers, central.points);
 	if (num_input_points < num_inner + 1)
 		return -1;
 
-	std::unordered_set<size_t> claimed;
+	claimedset_t claimed;
+	claimed.num = 0;
 	for (int i=0;i<num_inner+1;i++)
 	{
-		output->ordering[i] = central.ordering[i];
-		output->nbr_indices[i] = central.nbr_indices[i];
-		output->numbers[i] = central.numbers[i];
-		memcpy(output->points[i], central.points[i], 3 * sizeof(double));
+		output->ordering[i] = central->ordering[i];
+		output->nbr_indices[i] = central->nbr_indices[i];
+		output->numbers[i] = central->numbers[i];
+		memcpy(output->points[i], central->points[i], 3 * sizeof(double));
 
-		claimed.insert(central.nbr_indices[i]);
+		claim(&claimed, central->nbr_indices[i]);
 	}
 
 	int num_inserted = 0;
-	sorthelper_t data[MAX_INNER * PTM_MAX_INPUT_POINTS];
+	shellhelper_t data[MAX_INNER * PTM_MAX_INPUT_POINTS];
 	for (int i=0;i<num_inner;i++)
 	{
 		ptm::atomicenv_t inner;
-		int num_points = get_neighbours(nbrlist, -1, central.nbr_indices[1 + i], PTM_MAX_INPUT_POINTS, inner.ordering, inner.nbr_indices, inner.numbers, inner.points);
+		int num_points = get_neighbours(nbrlist, -1, central->nbr_indices[1 + i], PTM_MAX_INPUT_POINTS, inner.ordering, inner.nbr_indices, inner.numbers, inner.points);
 		if (num_points < num_inner + 1)
 			return -1;
 
 		for (int j=0;j<num_points;j++)
 		{
 			size_t key = inner.nbr_indices[j];
-
-			bool already_claimed = claimed.find(key) != claimed.end();
-			if (already_claimed)
+			if (is_claimed(&claimed, key))
 				continue;
 
 			data[num_inserted].inner = i;
@@ -88,23 +116,22 @@ int calculate_two_shell_neighbour_ordering(	int num_inner, int num_outer,
 
 			memcpy(data[num_inserted].offset, inner.points[j], 3 * sizeof(double));
 			for (int k=0;k<3;k++)
-				data[num_inserted].offset[k] += central.points[1 + i][k];
+				data[num_inserted].offset[k] += central->points[1 + i][k];
 
 			num_inserted++;
 		}
 	}
 
-	std::sort(data, data + num_inserted, &sorthelper_compare);
+	std::sort(data, data + num_inserted, &shellhelper_compare);
 
 	int num_found = 0;
 	int counts[MAX_INNER] = {0};
 	for (int i=0;i<num_inserted;i++)
 	{
 		int inner = data[i].inner;
-		int nbr_atom_index = data[i].atom_index;
+		size_t nbr_atom_index = data[i].atom_index;
 
-		bool already_claimed = claimed.find(nbr_atom_index) != claimed.end();
-		if (counts[inner] >= num_outer || already_claimed)
+		if (counts[inner] >= num_outer || is_claimed(&claimed, nbr_atom_index))
 			continue;
 
 		output->ordering[1 + num_inner + num_outer * inner + counts[inner]] = data[i].ordering;
@@ -112,7 +139,7 @@ int calculate_two_shell_neighbour_ordering(	int num_inner, int num_outer,
 		output->nbr_indices[1 + num_inner + num_outer * inner + counts[inner]] = nbr_atom_index;
 		output->numbers[1 + num_inner + num_outer * inner + counts[inner]] = data[i].number;
 		memcpy(output->points[1 + num_inner + num_outer * inner + counts[inner]], &data[i].offset, 3 * sizeof(double));
-		claimed.insert(nbr_atom_index);
+		claim(&claimed, nbr_atom_index);
 
 		counts[inner]++;
 		num_found++;
@@ -23,9 +23,11 @@ typedef struct
 } atomicenv_t;
 
 
+//central holds the num_central points already gathered for atom_index (central atom included),
+//or is NULL if they must be fetched with get_neighbours.
 int calculate_two_shell_neighbour_ordering(	int num_inner, int num_outer,
 						size_t atom_index, int (get_neighbours)(void* vdata, size_t _unused_lammps_variable, size_t atom_index, int num, int* ordering, size_t* nbr_indices, int32_t* numbers, double (*nbr_pos)[3]), void* nbrlist,
-						ptm::atomicenv_t* output);
+						const ptm::atomicenv_t* central, int num_central, ptm::atomicenv_t* output);
 }
 
 #endif
@@ -20,6 +20,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include "ptm_voronoi_cell.h"
 #include "ptm_neighbour_ordering.h"
 #include "ptm_normalize_vertices.h"
+#include "ptm_stats.h"
 
 
 namespace ptm {
@@ -45,19 +46,19 @@ static bool sorthelper_compare(sorthelper_t const& a, sorthelper_t const& b)
 	return false;
 }
 
-static double dot_product(double* a, double* b)
+static double dot_product(const double* a, const double* b)
 {
 	return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
 }
 
-static void cross_product(double* a, double* b, double* c)
+static void cross_product(const double* a, const double* b, double* c)
 {
 	c[0] = a[1] * b[2] - a[2] * b[1];
 	c[1] = a[2] * b[0] - a[0] * b[2];
 	c[2] = a[0] * b[1] - a[1] * b[0];
 }
 
-static double calculate_solid_angle(double* R1, double* R2, double* R3)	//norms of R1-R3 must be 1
+static double calculate_solid_angle(const double* R1, const double* R2, const double* R3)	//norms of R1-R3 must be 1
 {
 	double R2R3[3];
 	cross_product(R2, R3, R2R3);
@@ -71,10 +72,24 @@ static double calculate_solid_angle(double* R1, double* R2, double* R3)	//norms
 	return fabs(2 * atan2(numerator, denominator));
 }
 
+//a Voronoi cell has a face per neighbour and up to six faces from the initial box
+#define MAX_VORONOI_FACES	(PTM_MAX_INPUT_POINTS + 6)
+#define MAX_VORONOI_VERTICES	(2 * MAX_VORONOI_FACES - 4)
+#define MAX_FACE_LIST_SIZE	(7 * MAX_VORONOI_FACES)
+
+//per-thread Voronoi cell and output buffers, so that ordering neighbours does not allocate
+typedef struct
+{
+	ptm_voro::voronoicell_neighbor cell;
+	int nbr_indices[MAX_VORONOI_FACES];
+	int face_vertices[MAX_FACE_LIST_SIZE];
+	double vertices[MAX_VORONOI_VERTICES][3];
+} voronoidata_t;
+
 //todo: change voronoi code to return errors rather than exiting
-static int calculate_voronoi_face_areas(int num_points, const double (*_points)[3], double* normsq, double max_norm, ptm_voro::voronoicell_neighbor* v, bool calc_solid_angles,
-						std::vector<int>& nbr_indices, std::vector<double>& face_areas)
+static int calculate_voronoi_face_areas(int num_points, const double (*_points)[3], double* normsq, double max_norm, voronoidata_t* vd, double* areas)
 {
+	ptm_voro::voronoicell_neighbor* v = &vd->cell;
 	const double k = 10 * max_norm;
 	v->init(-k,k,-k,k,-k,k);
 
@@ -86,56 +101,51 @@ static int calculate_voronoi_face_areas(int num_points, const double (*_points)[
 		v->nplane(x,y,z,normsq[i],i);
 	}
 
-	v->neighbors(nbr_indices);
-
-	std::vector<int> face_vertices;
-	std::vector<double> vertices;
-
-	v->face_vertices(face_vertices);
-	v->vertices(0, 0, 0, vertices);
+	int num_faces = v->face_list(MAX_VORONOI_FACES, MAX_FACE_LIST_SIZE, vd->nbr_indices, vd->face_vertices);
+	if (num_faces < 0 || v->p > MAX_VORONOI_VERTICES)
+		return -1;
 
-	size_t num_vertices = vertices.size() / 3;
-	for (size_t i=0;i<num_vertices;i++)
+	//only the directions of the vertices are needed, so the scale of the cell coordinates does not matter
+	double (*vertices)[3] = vd->vertices;
+	for (int i=0;i<v->p;i++)
 	{
-		double x = vertices[i * 3 + 0];
-		double y = vertices[i * 3 + 1];
-		double z = vertices[i * 3 + 2];
+		double x = v->pts[i * 3 + 0];
+		double y = v->pts[i * 3 + 1];
+		double z = v->pts[i * 3 + 2];
 
 		double s = sqrt(x*x + y*y + z*z);
-		vertices[i * 3 + 0] /= s;
-		vertices[i * 3 + 1] /= s;
-		vertices[i * 3 + 2] /= s;
+		vertices[i][0] = x / s;
+		vertices[i][1] = y / s;
+		vertices[i][2] = z / s;
 	}
 
-	int num_faces = v->number_of_faces();
-
-	size_t c = 0;
+	int c = 0;
 	for (int current_face=0;current_face<num_faces;current_face++)
 	{
-		int num = face_vertices[c++];
+		int* face = &vd->face_vertices[c];
+		int num = face[0];
 
-		int point_index = nbr_indices[current_face];
+		int point_index = vd->nbr_indices[current_face];
 		if (point_index >= 0)
 		{
 			double solid_angle = 0;
-			int u = face_vertices[c];
-			int v = face_vertices[c+1];
+			int u = face[1];
+			int v = face[2];
 			for (int i=2;i<num;i++)
 			{
-				int w = face_vertices[c+i];
-				double omega = calculate_solid_angle(&vertices[u*3], &vertices[v*3], &vertices[w*3]);
+				int w = face[i+1];
+				double omega = calculate_solid_angle(vertices[u], vertices[v], vertices[w]);
 				solid_angle += omega;
 
 				v = w;
 			}
 
-			face_areas[current_face] = solid_angle;
+			areas[point_index] = solid_angle;
 		}
 
-		c += num;
+		c += num + 1;
 	}
 
-	assert(c == face_vertices.size());
 	return 0;
 }
 
@@ -143,7 +153,7 @@ static int calculate_neighbour_ordering(void* _voronoi_handle, int num, double (
 {
 	assert(num <= PTM_MAX_INPUT_POINTS);
 
-	ptm_voro::voronoicell_neighbor* voronoi_handle = (ptm_voro::voronoicell_neighbor*)_voronoi_handle;
+	voronoidata_t* voronoi_handle = (voronoidata_t*)_voronoi_handle;
 
 	double max_norm = 0;
 	double points[PTM_MAX_INPUT_POINTS][3];
@@ -164,20 +174,11 @@ static int calculate_neighbour_ordering(void* _voronoi_handle, int num, double (
 
 	max_norm = sqrt(max_norm);
 
-	std::vector<int> nbr_indices(num + 6);
-	std::vector<double> face_areas(num + 6);
-	int ret = calculate_voronoi_face_areas(num, points, normsq, max_norm, voronoi_handle, true, nbr_indices, face_areas);
+	double areas[PTM_MAX_INPUT_POINTS] = {0};
+	int ret = calculate_voronoi_face_areas(num, points, normsq, max_norm, voronoi_handle, areas);
 	if (ret != 0)
 		return ret;
 
-	double areas[PTM_MAX_INPUT_POINTS] = {0};
-	for (size_t i=0;i<nbr_indices.size();i++)
-	{
-		int index = nbr_indices[i];
-		if (index >= 0)
-			areas[index] = face_areas[i];
-	}
-
 	for (int i=0;i<num;i++)
 	{
 		assert(areas[i] == areas[i]);
@@ -190,15 +191,28 @@ static int calculate_neighbour_ordering(void* _voronoi_handle, int num, double (
 	return ret;
 }
 
+int calculate_voronoi_ordering(void* voronoi_handle, int num, double (*points)[3], int* ordering)
+{
+	sorthelper_t data[PTM_MAX_INPUT_POINTS];
+	int ret = calculate_neighbour_ordering(voronoi_handle, num, points, data);
+	if (ret != 0)
+		return ret;
+
+	for (int i=0;i<num;i++)
+		ordering[i] = data[i].ordering;
+
+	return PTM_NO_ERROR;
+}
+
 void* voronoi_initialize_local()
 {
-	ptm_voro::voronoicell_neighbor* ptr = new ptm_voro::voronoicell_neighbor;
+	voronoidata_t* ptr = new voronoidata_t;
 	return (void*)ptr;
 }
 
 void voronoi_uninitialize_local(void* _ptr)
 {
-	ptm_voro::voronoicell_neighbor* ptr = (ptm_voro::voronoicell_neighbor*)_ptr;
+	voronoidata_t* ptr = (voronoidata_t*)_ptr;
 	delete ptr;
 }
 
@@ -270,9 +284,12 @@ int preorder_neighbours(void* _voronoi_handle, int num_input_points, double (*in
 extern "C" {
 #endif
 
-int ptm_preorder_neighbours(void* _voronoi_handle, int num_input_points, double (*input_points)[3], uint64_t* res)
+int ptm_preorder_neighbours(ptm_local_handle_t local_handle, int num_input_points, double (*input_points)[3], uint64_t* res)
 {
-	return ptm::preorder_neighbours(_voronoi_handle, num_input_points, input_points, res);
+	PTM_STATS_START(start);
+	int ret = ptm::preorder_neighbours(local_handle->voronoi_handle, num_input_points, input_points, res);
+	PTM_STATS_STOP(ptm::local_stats(local_handle), PTM_STAGE_VORONOI, start);
+	return ret;
 }
 
 void ptm_index_to_permutation(int n, uint64_t k, int* permuted)
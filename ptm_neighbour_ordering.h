@@ -17,6 +17,10 @@ namespace ptm {
 void* voronoi_initialize_local();
 void voronoi_uninitialize_local(void* ptr);
 
+//Orders num points by the solid angle of their Voronoi faces, largest first, with ties broken by distance.
+//ordering is only written on success.
+int calculate_voronoi_ordering(void* voronoi_handle, int num, double (*points)[3], int* ordering);
+
 }
 
 #endif
@@ -0,0 +1,404 @@
+/*Copyright (c) 2016 PM Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <cmath>
+#include <cfloat>
+#include <cassert>
+#include <cstdint>
+#include <algorithm>
+#include <vector>
+#include "ptm_constants.h"
+#include "ptm_functions.h"
+#include "ptm_neighbour_search.h"
+#include "ptm_parallel.h"
+
+
+//average number of atoms in a grid cell
+#define PTM_ATOMS_PER_CELL 4
+
+namespace ptm {
+
+bool invert_matrix_3x3(const double* A, double* inverse)
+{
+	double det =	  A[0] * (A[4] * A[8] - A[5] * A[7])
+			- A[1] * (A[3] * A[8] - A[5] * A[6])
+			+ A[2] * (A[3] * A[7] - A[4] * A[6]);
+	if (det == 0)
+		return false;
+
+	inverse[0] = (A[4] * A[8] - A[5] * A[7]) / det;
+	inverse[1] = (A[2] * A[7] - A[1] * A[8]) / det;
+	inverse[2] = (A[1] * A[5] - A[2] * A[4]) / det;
+	inverse[3] = (A[5] * A[6] - A[3] * A[8]) / det;
+	inverse[4] = (A[0] * A[8] - A[2] * A[6]) / det;
+	inverse[5] = (A[2] * A[3] - A[0] * A[5]) / det;
+	inverse[6] = (A[3] * A[7] - A[4] * A[6]) / det;
+	inverse[7] = (A[1] * A[6] - A[0] * A[7]) / det;
+	inverse[8] = (A[0] * A[4] - A[1] * A[3]) / det;
+	return true;
+}
+
+//distances between the lattice planes spanned by each pair of cell vectors; the columns of the
+//inverse cell are the reciprocal vectors
+void perpendicular_widths(const double* inverse_cell, double* widths)
+{
+	for (int j=0;j<3;j++)
+		widths[j] = 1 / sqrt(	  inverse_cell[0 * 3 + j] * inverse_cell[0 * 3 + j]
+					+ inverse_cell[1 * 3 + j] * inverse_cell[1 * 3 + j]
+					+ inverse_cell[2 * 3 + j] * inverse_cell[2 * 3 + j]);
+}
+
+//Rounding the fractional coordinates gives the nearest image in an orthogonal cell, but in a skewed
+//cell adding a lattice vector L may still shorten delta.  That needs |L| < 2|delta|, and a lattice
+//vector with n_j steps along cell vector j has |L| >= |n_j| widths[j], so only |n_j| < 2|delta| / widths[j]
+//are searched.
+static void search_images(const double* cell, const double* widths, const bool* pbc, double best, double* delta)
+{
+	int range[3];
+	for (int j=0;j<3;j++)
+		range[j] = pbc[j] ? (int)(2 * sqrt(best) / widths[j]) : 0;
+
+	double nearest[3] = {delta[0], delta[1], delta[2]};
+	for (int n0=-range[0];n0<=range[0];n0++)
+	{
+		for (int n1=-range[1];n1<=range[1];n1++)
+		{
+			for (int n2=-range[2];n2<=range[2];n2++)
+			{
+				double x[3];
+				for (int j=0;j<3;j++)
+					x[j] = delta[j] + n0 * cell[0 * 3 + j] + n1 * cell[1 * 3 + j] + n2 * cell[2 * 3 + j];
+
+				double d = x[0] * x[0] + x[1] * x[1] + x[2] * x[2];
+				if (d < best)
+				{
+					best = d;
+					memcpy(nearest, x, 3 * sizeof(double));
+				}
+			}
+		}
+	}
+
+	memcpy(delta, nearest, 3 * sizeof(double));
+}
+
+//the image of rounded fractional coordinates is the nearest one unless it is longer than half the
+//smallest periodic width, when nearby images are searched too
+void minimum_image(const double* cell, const double* inverse_cell, const double* widths, const bool* pbc, double* delta)
+{
+	//fractional coordinates (cell vectors are rows)
+	double f[3];
+	for (int j=0;j<3;j++)
+	{
+		f[j] = delta[0] * inverse_cell[0 * 3 + j] + delta[1] * inverse_cell[1 * 3 + j] + delta[2] * inverse_cell[2 * 3 + j];
+		if (pbc[j])
+			f[j] -= round(f[j]);
+	}
+
+	for (int j=0;j<3;j++)
+		delta[j] = f[0] * cell[0 * 3 + j] + f[1] * cell[1 * 3 + j] + f[2] * cell[2 * 3 + j];
+
+	double d = delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2];
+	for (int j=0;j<3;j++)
+	{
+		if (pbc[j] && 4 * d >= widths[j] * widths[j])
+		{
+			search_images(cell, widths, pbc, d, delta);
+			return;
+		}
+	}
+}
+
+static void cross_product(const double* a, const double* b, double* c)
+{
+	c[0] = a[1] * b[2] - a[2] * b[1];
+	c[1] = a[2] * b[0] - a[0] * b[2];
+	c[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+int build_cell_grid(const ptm_system_t* system, cellgrid_t* grid)
+{
+	size_t num_atoms = system->num_atoms;
+	if (system->positions == NULL || num_atoms > INT32_MAX)
+		return -1;
+
+	grid->system = system;
+	if (system->cell != NULL)
+	{
+		memcpy(grid->cell, system->cell, 9 * sizeof(double));
+		memcpy(grid->pbc, system->pbc, 3 * sizeof(bool));
+	}
+	else
+	{
+		double identity[9] = {1, 0, 0, 0, 1, 0, 0, 0, 1};
+		memcpy(grid->cell, identity, 9 * sizeof(double));
+		grid->pbc[0] = grid->pbc[1] = grid->pbc[2] = false;
+	}
+
+	if (!invert_matrix_3x3(grid->cell, grid->inverse_cell))
+		return -1;
+	perpendicular_widths(grid->inverse_cell, grid->cell_widths);
+
+	//fractional coordinates, and their extent along the non-periodic directions
+	double lo[3] = {0, 0, 0}, hi[3] = {1, 1, 1};
+	for (int j=0;j<3;j++)
+		if (!grid->pbc[j])
+		{
+			lo[j] = DBL_MAX;
+			hi[j] = -DBL_MAX;
+		}
+
+	std::vector<double> frac(3 * num_atoms);
+	for (size_t i=0;i<num_atoms;i++)
+	{
+		const double* x = system->positions[i];
+		for (int j=0;j<3;j++)
+		{
+			const double* inv = grid->inverse_cell;
+			double f = x[0] * inv[0 * 3 + j] + x[1] * inv[1 * 3 + j] + x[2] * inv[2 * 3 + j];
+			if (grid->pbc[j])
+			{
+				f -= floor(f);
+			}
+			else
+			{
+				lo[j] = std::min(lo[j], f);
+				hi[j] = std::max(hi[j], f);
+			}
+
+			frac[i * 3 + j] = f;
+		}
+	}
+
+	//perpendicular widths of the occupied region, which set the grid dimensions
+	double det = fabs(	  grid->cell[0] * (grid->cell[4] * grid->cell[8] - grid->cell[5] * grid->cell[7])
+				- grid->cell[1] * (grid->cell[3] * grid->cell[8] - grid->cell[5] * grid->cell[6])
+				+ grid->cell[2] * (grid->cell[3] * grid->cell[7] - grid->cell[4] * grid->cell[6]));
+
+	double extent[3], volume = 1;
+	int num_extended = 0;
+	for (int j=0;j<3;j++)
+	{
+		double normal[3];
+		cross_product(&grid->cell[((j + 1) % 3) * 3], &grid->cell[((j + 2) % 3) * 3], normal);
+		double span = num_atoms == 0 ? 0 : hi[j] - lo[j];
+		extent[j] = span * det / sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+		if (extent[j] > 0)
+		{
+			volume *= extent[j];
+			num_extended++;
+		}
+	}
+
+	double num_cells = std::max(1.0, (double)num_atoms / PTM_ATOMS_PER_CELL);
+	double cells_per_length = num_extended == 0 ? 0 : pow(num_cells / volume, 1.0 / num_extended);
+	for (int j=0;j<3;j++)
+	{
+		double n = floor(extent[j] * cells_per_length);
+		grid->dims[j] = (int)std::max(1.0, std::min(n, 1024.0));
+		grid->width[j] = extent[j] / grid->dims[j];
+	}
+
+	//bin the atoms into grid cells
+	size_t total_cells = (size_t)grid->dims[0] * grid->dims[1] * grid->dims[2];
+	grid->atom_cell.resize(num_atoms);
+	grid->cell_start.assign(total_cells + 1, 0);
+	for (size_t i=0;i<num_atoms;i++)
+	{
+		int c[3];
+		for (int j=0;j<3;j++)
+		{
+			double span = hi[j] - lo[j];
+			double u = span > 0 ? (frac[i * 3 + j] - lo[j]) / span : 0;
+			c[j] = std::max(0, std::min(grid->dims[j] - 1, (int)(u * grid->dims[j])));
+		}
+
+		int index = (c[0] * grid->dims[1] + c[1]) * grid->dims[2] + c[2];
+		grid->atom_cell[i] = index;
+		grid->cell_start[index + 1]++;
+	}
+
+	for (size_t i=0;i<total_cells;i++)
+		grid->cell_start[i + 1] += grid->cell_start[i];
+
+	std::vector<int> fill(grid->cell_start.begin(), grid->cell_start.end() - 1);
+	grid->cell_atoms.resize(num_atoms);
+	for (size_t i=0;i<num_atoms;i++)
+		grid->cell_atoms[fill[grid->atom_cell[i]]++] = i;
+
+	return PTM_NO_ERROR;
+}
+
+//inserts a neighbour into the list sorted by distance (and index, to break ties)
+static int insert_neighbour(int n, int num, double* dist, int32_t* nbrs, double d, int32_t index)
+{
+	if (n == num && (d > dist[n - 1] || (d == dist[n - 1] && index > nbrs[n - 1])))
+		return n;
+
+	int k = n < num ? n++ : num - 1;
+	while (k > 0 && (dist[k - 1] > d || (dist[k - 1] == d && nbrs[k - 1] > index)))
+	{
+		dist[k] = dist[k - 1];
+		nbrs[k] = nbrs[k - 1];
+		k--;
+	}
+
+	dist[k] = d;
+	nbrs[k] = index;
+	return n;
+}
+
+static int search_cell(const cellgrid_t* grid, int cell_index, size_t atom_index, int n, int num, double* dist, int32_t* nbrs)
+{
+	const ptm_system_t* system = grid->system;
+	const double* x0 = system->positions[atom_index];
+	bool periodic = grid->pbc[0] || grid->pbc[1] || grid->pbc[2];
+
+	for (int k=grid->cell_start[cell_index];k<grid->cell_start[cell_index + 1];k++)
+	{
+		int32_t index = grid->cell_atoms[k];
+		if ((size_t)index == atom_index)
+			continue;
+
+		const double* x1 = system->positions[index];
+		double delta[3] = {x1[0] - x0[0], x1[1] - x0[1], x1[2] - x0[2]};
+		if (periodic)
+			minimum_image(grid->cell, grid->inverse_cell, grid->cell_widths, grid->pbc, delta);
+
+		double d = delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2];
+		n = insert_neighbour(n, num, dist, nbrs, d, index);
+	}
+
+	return n;
+}
+
+//Searches rings of grid cells around the atom until no unsearched atom can be nearer than the
+//num'th neighbour found.  Atoms outside ring r are at least r grid cell widths away if their
+//nearest image is the one of rounded fractional coordinates, which holds for all images within
+//half the smallest periodic cell width (see minimum_image).  Beyond that a skewed cell is searched in full.
+int find_nearest_neighbours(const cellgrid_t* grid, size_t atom_index, int num, int32_t* nbrs)
+{
+	assert(num <= PTM_MAX_INPUT_POINTS - 1);
+
+	const int* dims = grid->dims;
+	int home = grid->atom_cell[atom_index];
+	int c[3] = {home / (dims[1] * dims[2]), (home / dims[2]) % dims[1], home % dims[2]};
+
+	//range of cell offsets which visits every grid cell once
+	int lo[3], hi[3];
+	for (int j=0;j<3;j++)
+	{
+		if (grid->pbc[j])
+		{
+			lo[j] = -((dims[j] - 1) / 2);
+			hi[j] = dims[j] - 1 + lo[j];
+		}
+		else
+		{
+			lo[j] = -c[j];
+			hi[j] = dims[j] - 1 - c[j];
+		}
+	}
+
+	int n = 0;
+	double dist[PTM_MAX_INPUT_POINTS];
+	for (int r=0;;r++)
+	{
+		int a0 = std::max(lo[0], -r), b0 = std::min(hi[0], r);
+		int a1 = std::max(lo[1], -r), b1 = std::min(hi[1], r);
+		int a2 = std::max(lo[2], -r), b2 = std::min(hi[2], r);
+		for (int d0=a0;d0<=b0;d0++)
+		{
+			for (int d1=a1;d1<=b1;d1++)
+			{
+				bool inner = abs(d0) < r && abs(d1) < r;
+				for (int d2=a2;d2<=b2;d2++)
+				{
+					if (inner && abs(d2) < r)
+						d2 = r;
+					if (d2 > b2)
+						break;
+
+					int i0 = (c[0] + d0 + dims[0]) % dims[0];
+					int i1 = (c[1] + d1 + dims[1]) % dims[1];
+					int i2 = (c[2] + d2 + dims[2]) % dims[2];
+					n = search_cell(grid, (i0 * dims[1] + i1) * dims[2] + i2, atom_index, n, num, dist, nbrs);
+				}
+			}
+		}
+
+		bool saturated = true;
+		double bound = INFINITY;
+		for (int j=0;j<3;j++)
+		{
+			if (-r > lo[j] || r < hi[j])
+			{
+				saturated = false;
+				bound = std::min(bound, r * grid->width[j]);
+			}
+		}
+
+		if (saturated)
+			break;
+
+		for (int j=0;j<3;j++)
+			if (grid->pbc[j])
+				bound = std::min(bound, 0.5 * grid->cell_widths[j]);
+
+		if (n == num && dist[n - 1] <= bound * bound)
+			break;
+	}
+
+	return n;
+}
+
+}
+
+typedef struct
+{
+	const ptm::cellgrid_t* grid;
+	int max_nbrs;
+	int32_t* nbrs;
+} searchdata_t;
+
+static void search_chunk(void* vdata, int thread_index, size_t begin, size_t end)
+{
+	(void)thread_index;
+	searchdata_t* s = (searchdata_t*)vdata;
+
+	//atoms are visited in grid cell order, so that consecutive searches touch the same cells
+	for (size_t k=begin;k<end;k++)
+	{
+		size_t i = s->grid->cell_atoms[k];
+		int32_t* row = &s->nbrs[i * s->max_nbrs];
+		int n = ptm::find_nearest_neighbours(s->grid, i, s->max_nbrs, row);
+		for (int j=n;j<s->max_nbrs;j++)
+			row[j] = -1;
+	}
+}
+
+int ptm_build_neighbour_table(const ptm_system_t* system, int max_nbrs, int num_threads, int32_t* nbrs)
+{
+	if (max_nbrs <= 0 || max_nbrs > PTM_MAX_INPUT_POINTS - 1)
+		return -1;
+
+	ptm::cellgrid_t grid;
+	int ret = ptm::build_cell_grid(system, &grid);
+	if (ret != PTM_NO_ERROR)
+		return ret;
+
+	if (num_threads <= 0)
+		num_threads = ptm::default_num_threads();
+
+	searchdata_t s = {&grid, max_nbrs, nbrs};
+	ptm::parallel_for(system->num_atoms, 1024, num_threads, search_chunk, (void*)&s);
+	return PTM_NO_ERROR;
+}
+
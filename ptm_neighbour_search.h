@@ -0,0 +1,43 @@
+/*Copyright (c) 2016 PM Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef PTM_NEIGHBOUR_SEARCH_H
+#define PTM_NEIGHBOUR_SEARCH_H
+
+#include <cstddef>
+#include <vector>
+#include "ptm_functions.h"
+
+namespace ptm {
+
+typedef struct
+{
+	const ptm_system_t* system;
+	double cell[9];			//cell vectors as rows; the bounding box for non-periodic systems
+	double inverse_cell[9];
+	double cell_widths[3];		//perpendicular widths of the cell, see minimum_image
+	bool pbc[3];
+	int dims[3];			//number of grid cells along each cell vector
+	double width[3];		//perpendicular width of a grid cell along each cell vector
+	std::vector<int> cell_start;	//atoms of grid cell c are cell_atoms[cell_start[c]..cell_start[c+1]]
+	std::vector<int32_t> cell_atoms;
+	std::vector<int> atom_cell;
+} cellgrid_t;
+
+bool invert_matrix_3x3(const double* A, double* inverse);
+void perpendicular_widths(const double* inverse_cell, double* widths);
+void minimum_image(const double* cell, const double* inverse_cell, const double* widths, const bool* pbc, double* delta);
+
+int build_cell_grid(const ptm_system_t* system, cellgrid_t* grid);
+int find_nearest_neighbours(const cellgrid_t* grid, size_t atom_index, int num, int32_t* nbrs);
+
+}
+
+#endif
+
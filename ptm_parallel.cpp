@@ -0,0 +1,160 @@
+/*Copyright (c) 2016 PM Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstdint>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include "ptm_parallel.h"
+
+
+namespace ptm {
+
+//a range of unclaimed chunks [lo, hi), packed into one word so that it can be updated atomically
+typedef struct
+{
+	std::atomic<uint64_t> range;
+	char padding[64 - sizeof(std::atomic<uint64_t>)];	//one range per cache line
+} workqueue_t;
+
+static uint64_t pack_range(uint32_t lo, uint32_t hi)
+{
+	return ((uint64_t)lo << 32) | hi;
+}
+
+static uint32_t range_lo(uint64_t range)
+{
+	return range >> 32;
+}
+
+static uint32_t range_hi(uint64_t range)
+{
+	return range & 0xFFFFFFFF;
+}
+
+//takes a chunk from the front of the owner's own queue
+static bool pop_chunk(workqueue_t* queue, uint32_t* p_chunk)
+{
+	uint64_t range = queue->range.load();
+	while (range_lo(range) < range_hi(range))
+	{
+		uint32_t lo = range_lo(range);
+		if (queue->range.compare_exchange_weak(range, pack_range(lo + 1, range_hi(range))))
+		{
+			*p_chunk = lo;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+//takes the back half of the fullest queue, returns the first stolen chunk and keeps the rest
+static bool steal_chunks(int num_threads, workqueue_t* queues, int thief, uint32_t* p_chunk)
+{
+	while (true)
+	{
+		int victim = -1;
+		uint32_t max_remaining = 0;
+		uint64_t range = 0;
+		for (int i=0;i<num_threads;i++)
+		{
+			uint64_t r = queues[i].range.load();
+			uint32_t remaining = range_hi(r) > range_lo(r) ? range_hi(r) - range_lo(r) : 0;
+			if (i != thief && remaining > max_remaining)
+			{
+				victim = i;
+				max_remaining = remaining;
+				range = r;
+			}
+		}
+
+		if (victim == -1)
+			return false;
+
+		uint32_t lo = range_lo(range), hi = range_hi(range);
+		uint32_t mid = hi - (hi - lo + 1) / 2;
+		if (queues[victim].range.compare_exchange_strong(range, pack_range(lo, mid)))
+		{
+			queues[thief].range.store(pack_range(mid + 1, hi));
+			*p_chunk = mid;
+			return true;
+		}
+	}
+}
+
+typedef struct
+{
+	size_t num_items;
+	size_t chunk_size;
+	int num_threads;
+	workqueue_t* queues;
+	void (*body)(void* vdata, int thread_index, size_t begin, size_t end);
+	void* vdata;
+} pooldata_t;
+
+static void worker(pooldata_t* pool, int thread_index)
+{
+	workqueue_t* queue = &pool->queues[thread_index];
+
+	uint32_t chunk = 0;
+	while (pop_chunk(queue, &chunk) || steal_chunks(pool->num_threads, pool->queues, thread_index, &chunk))
+	{
+		size_t begin = chunk * pool->chunk_size;
+		size_t end = std::min(begin + pool->chunk_size, pool->num_items);
+		pool->body(pool->vdata, thread_index, begin, end);
+	}
+}
+
+void parallel_for(	size_t num_items, size_t chunk_size, int num_threads,
+			void (body)(void* vdata, int thread_index, size_t begin, size_t end), void* vdata)
+{
+	if (num_items == 0)
+		return;
+
+	chunk_size = std::max(chunk_size, (num_items + UINT32_MAX - 1) / UINT32_MAX);
+	chunk_size = std::max(chunk_size, (size_t)1);
+	size_t num_chunks = (num_items + chunk_size - 1) / chunk_size;
+	num_threads = std::max(1, std::min(num_threads, (int)std::min(num_chunks, (size_t)INT32_MAX)));
+
+	if (num_threads == 1)
+	{
+		body(vdata, 0, 0, num_items);
+		return;
+	}
+
+	std::vector<workqueue_t> queues(num_threads);
+	for (int i=0;i<num_threads;i++)
+	{
+		uint32_t lo = num_chunks * i / num_threads;
+		uint32_t hi = num_chunks * (i + 1) / num_threads;
+		queues[i].range.store(pack_range(lo, hi));
+	}
+
+	pooldata_t pool = {num_items, chunk_size, num_threads, queues.data(), body, vdata};
+
+	std::vector<std::thread> threads;
+	for (int i=1;i<num_threads;i++)
+		threads.push_back(std::thread(worker, &pool, i));
+
+	worker(&pool, 0);
+
+	for (size_t i=0;i<threads.size();i++)
+		threads[i].join();
+}
+
+int default_num_threads()
+{
+	unsigned int n = std::thread::hardware_concurrency();
+	return n == 0 ? 1 : (int)n;
+}
+
+}
+
@@ -0,0 +1,27 @@
+/*Copyright (c) 2016 PM Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef PTM_PARALLEL_H
+#define PTM_PARALLEL_H
+
+#include <cstddef>
+
+namespace ptm {
+
+//Calls body(vdata, thread_index, begin, end) for chunks of [0, num_items) on num_threads threads.
+//Each thread starts with a contiguous block of chunks and steals from the busiest thread when done.
+void parallel_for(	size_t num_items, size_t chunk_size, int num_threads,
+			void (body)(void* vdata, int thread_index, size_t begin, size_t end), void* vdata);
+
+int default_num_threads();
+
+}
+
+#endif
+
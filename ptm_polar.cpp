@@ -121,9 +121,8 @@ static void flip_matrix(double* A)
                 A[i] = -A[i];
 }
 
-static bool optimal_quaternion(double* A, bool polar, double E0, double* p_nrmsdsq, double* qopt)
+static double max_eigenvalue(const double* A, bool polar, double E0)
 {
-        const double evecprec = 1e-6;
         const double evalprec = 1e-11;
 
         double        Sxx = A[0], Sxy = A[1], Sxz = A[2],
@@ -180,6 +179,26 @@ static bool optimal_quaternion(double* A, bool polar, double E0, double* p_nrmsd
                 mxEigenV = 0.0;
         }
 
+        return mxEigenV;
+}
+
+static bool optimal_quaternion(double* A, double E0, double mxEigenV, double* p_nrmsdsq, double* qopt)
+{
+        const double evecprec = 1e-6;
+
+        double        Sxx = A[0], Sxy = A[1], Sxz = A[2],
+                Syx = A[3], Syy = A[4], Syz = A[5],
+                Szx = A[6], Szy = A[7], Szz = A[8];
+
+        double SxzpSzx = Sxz + Szx;
+        double SyzpSzy = Syz + Szy;
+        double SxypSyx = Sxy + Syx;
+        double SyzmSzy = Syz - Szy;
+        double SxzmSzx = Sxz - Szx;
+        double SxymSyx = Sxy - Syx;
+        double SxxpSyy = Sxx + Syy;
+        double SxxmSyy = Sxx - Syy;
+
         (*p_nrmsdsq) = std::max(0.0, 2.0 * (E0 - mxEigenV));
 
         double a11 = SxxpSyy + Szz - mxEigenV;
@@ -285,7 +304,7 @@ int polar_decomposition_3x3(double* _A, bool right_sided, double* U, double* P)
 
         double q[4];
         double nrmsdsq = 0;
-        optimal_quaternion(A, true, -1, &nrmsdsq, q);
+        optimal_quaternion(A, -1, max_eigenvalue(A, true, -1), &nrmsdsq, q);
         q[0] = -q[0];
         quaternion_to_rotation_matrix(q, U);
 
@@ -330,12 +349,22 @@ void InnerProduct(double *A, int num, const double (*coords1)[3], double (*coord
         }
 }
 
-int FastCalcRMSDAndRotation(double *A, double E0, double *p_nrmsdsq, double *q, double* U)
+double FastCalcMaxEigenvalue(double *A, double E0)
 {
-        optimal_quaternion(A, false, E0, p_nrmsdsq, q);
+        return max_eigenvalue(A, false, E0);
+}
+
+int FastCalcRotation(double *A, double E0, double mxEigenV, double *p_nrmsdsq, double *q, double* U)
+{
+        optimal_quaternion(A, E0, mxEigenV, p_nrmsdsq, q);
         quaternion_to_rotation_matrix(q, U);
         return 0;
 }
 
+int FastCalcRMSDAndRotation(double *A, double E0, double *p_nrmsdsq, double *q, double* U)
+{
+        return FastCalcRotation(A, E0, FastCalcMaxEigenvalue(A, E0), p_nrmsdsq, q, U);
+}
+
 }
 
@@ -19,6 +19,10 @@ int polar_decomposition_3x3(double* _A, bool right_sided, double* U, double* P);
 void InnerProduct(double *A, int num, const double (*coords1)[3], double (*coords2)[3], int8_t* permutation);
 int FastCalcRMSDAndRotation(double *A, double E0, double *p_nrmsdsq, double *q, double* U);
 
+//the two halves of FastCalcRMSDAndRotation; the eigenvalue alone determines the RMSD
+double FastCalcMaxEigenvalue(double *A, double E0);
+int FastCalcRotation(double *A, double E0, double mxEigenV, double *p_nrmsdsq, double *q, double* U);
+
 }
 
 #endif
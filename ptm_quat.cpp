@@ -177,9 +177,11 @@ static void rotate_and_flip(double* q, double* r)
         }
 }
 
-static int rotate_quaternion_into_fundamental_zone(int num_generators, const double (*generator)[4], double* q)
+int rotate_quaternion_into_fundamental_zone(int num_generators, const double (*generator)[4], double* q)
 {
-        double max = 0.0;
+        //q can be orthogonal to every generator (e.g. a half turn about an axis in the basal plane
+        //with the three diamond hexagonal generators), so the first generator must always be accepted
+        double max = -1.0;
         int i = 0, bi = -1;
         for (i=0;i<num_generators;i++)
         {
@@ -238,6 +240,11 @@ int rotate_quaternion_into_diamond_hexagonal_fundamental_zone(double* q)
 
 
 
+void map_quaternion(double* q, const double* generator)
+{
+	rotate_and_flip(q, (double*)generator);
+}
+
 int map_quaternion_cubic(double* q, int i)
 {
 	rotate_and_flip(q, (double*)generator_cubic[i]);
@@ -149,6 +149,7 @@ const double generator_icosahedral[60][4] = {
 };
 
 
+int rotate_quaternion_into_fundamental_zone(int num_generators, const double (*generator)[4], double* q);
 int rotate_quaternion_into_cubic_fundamental_zone(double* q);
 int rotate_quaternion_into_diamond_cubic_fundamental_zone(double* q);
 int rotate_quaternion_into_icosahedral_fundamental_zone(double* q);
@@ -163,6 +164,7 @@ void rotation_matrix_to_quaternion(double* u, double* q);
 double quat_dot(double* a, double* b);
 double quat_misorientation(double* q1, double* q2);
 
+void map_quaternion(double* q, const double* generator);
 int map_quaternion_cubic(double* q, int i);
 int map_quaternion_diamond_cubic(double* q, int i);
 int map_quaternion_icosahedral(double* q, int i);
@@ -0,0 +1,64 @@
+/*Copyright (c) 2016 PM Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef PTM_STATS_H
+#define PTM_STATS_H
+
+#include <chrono>
+#include "ptm_functions.h"
+
+//per-thread state behind ptm_local_handle_t
+struct ptm_local_handle
+{
+	void* voronoi_handle;
+	ptm_stats_t stats;
+};
+
+namespace ptm {
+
+#ifdef PTM_ENABLE_STATS
+
+typedef std::chrono::steady_clock::time_point stats_time_t;
+
+inline ptm_stats_t* local_stats(ptm_local_handle_t local_handle)
+{
+	return local_handle == NULL ? NULL : &local_handle->stats;
+}
+
+inline void stats_add_time(ptm_stats_t* stats, int stage, stats_time_t start)
+{
+	if (stats == NULL)
+		return;
+
+	stats->calls[stage]++;
+	stats->seconds[stage] += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+#define PTM_STATS_START(start)			ptm::stats_time_t start = std::chrono::steady_clock::now()
+#define PTM_STATS_STOP(stats, stage, start)	ptm::stats_add_time(stats, stage, start)
+#define PTM_STATS_COUNT(stats, counter)		do { if ((stats) != NULL) (stats)->counter++; } while (0)
+
+#else
+
+inline ptm_stats_t* local_stats(ptm_local_handle_t local_handle)
+{
+	(void)local_handle;
+	return NULL;
+}
+
+#define PTM_STATS_START(start)
+#define PTM_STATS_STOP(stats, stage, start)	do {} while (0)
+#define PTM_STATS_COUNT(stats, counter)		do {} while (0)
+
+#endif
+
+}
+
+#endif
+
@@ -20,20 +20,26 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include "ptm_graph_tools.h"
 #include "ptm_normalize_vertices.h"
 #include "ptm_polar.h"
+#include "ptm_multi_rmsd.h"
 #include "ptm_structure_matcher.h"
+#include "ptm_stats.h"
 #include "ptm_constants.h"
 
 
 namespace ptm {
 
-static double calc_rmsd(int num_points, const double (*ideal_points)[3], double (*normalized)[3], int8_t* mapping,
-                        double G1, double G2, double E0, double* q, double* p_scale)
+//Returns false, without calculating the rotation, if the mapping cannot improve on max_rmsd.
+//A0 is the inner product matrix of the mapping and lambda its largest eigenvalue.
+static bool calc_rmsd(int num_points, const double (*ideal_points)[3], double (*normalized)[3], int8_t* mapping,
+                        double* A0, double lambda, double G1, double G2, double E0, double max_rmsd, double* p_rmsd, double* q, double* p_scale)
 {
-        double A0[9];
-        InnerProduct(A0, num_points, ideal_points, normalized, mapping);
+        //at the optimal scale the residual is G1 - lambda^2 / G2
+        const double bound_tolerance = 1E-9;
+        if (sqrt(fabs(G1 - lambda * lambda / G2) / num_points) > max_rmsd + bound_tolerance)
+                return false;
 
         double nrmsdsq, rot[9];
-        FastCalcRMSDAndRotation(A0, E0, &nrmsdsq, q, rot);
+        FastCalcRotation(A0, E0, lambda, &nrmsdsq, q, rot);
 
         double k0 = 0;
         for (int i=0;i<num_points;i++)
@@ -50,85 +56,183 @@ static double calc_rmsd(int num_points, const double (*ideal_points)[3], double
 
         double scale = k0 / G2;
         *p_scale = scale;
-        return sqrt(fabs(G1 - scale*k0) / num_points);
+        *p_rmsd = sqrt(fabs(G1 - scale*k0) / num_points);
+        return true;
+}
+
+static double sum_of_squares(int num_points, const double (*points)[3])
+{
+        double G = 0;
+        for (int i=0;i<num_points;i++)
+                G += points[i][0] * points[i][0] + points[i][1] * points[i][1] + points[i][2] * points[i][2];
+        return G;
 }
 
-static void check_graphs(        const refdata_t* s,
+//returns true if the mapping is the best so far
+static bool check_mapping(        const refdata_t* s, int num_points, double (*normalized)[3], int8_t* mapping,
+                                double* A, double lambda, double G1, double G2, double E0, result_t* res)
+{
+        double q[4], scale = 0, rmsd = INFINITY;
+        bool ok = calc_rmsd(num_points, s->points, normalized, mapping, A, lambda, G1, G2, E0, res->rmsd, &rmsd, q, &scale);
+        if (!ok || !(rmsd < res->rmsd))
+                return false;
+
+        res->rmsd = rmsd;
+        res->scale = scale;
+        res->ref_struct = s;
+        memcpy(res->q, q, 4 * sizeof(double));
+        memcpy(res->mapping, mapping, sizeof(int8_t) * num_points);
+        return true;
+}
+
+//Checks the graphs of the given structures which match the canonical hash.  With single
+//precision screening, the eigenvalues of symmetric graphs are first estimated in single
+//precision, and only mappings which might beat the best RMSD are evaluated in double precision.
+static void check_graphs(        int num_structures,
+                                const refdata_t** structures,
                                 uint64_t hash,
                                 int8_t* canonical_labelling,
                                 double (*normalized)[3],
+                                bool single_precision,
                                 result_t* res)
 {
-        int num_points = s->num_nbrs + 1;
-        const double (*ideal_points)[3] = s->points;
+        const graphentry_t* entries = NULL;
+        int num_entries = find_graphs(hash, &entries);
+        if (num_entries == 0 || num_structures == 0)
+        {
+                PTM_STATS_COUNT(res->stats, rejected[PTM_REJECT_HASH]);
+                return;
+        }
+
+        int num_points = structures[0]->num_nbrs + 1;
         int8_t inverse_labelling[PTM_MAX_POINTS];
-        int8_t mapping[PTM_MAX_POINTS];
+        int8_t mappings[PTM_NUM_FLOAT_LANES][PTM_MAX_POINTS];
 
         for (int i=0; i<num_points; i++)
                 inverse_labelling[ canonical_labelling[i] ] = i;
 
-        double G1 = 0, G2 = 0;
-        for (int i=0;i<num_points;i++)
-        {
-                double x1 = ideal_points[i][0];
-                double y1 = ideal_points[i][1];
-                double z1 = ideal_points[i][2];
+        double G2 = sum_of_squares(num_points, normalized);
 
-                double x2 = normalized[i][0];
-                double y2 = normalized[i][1];
-                double z2 = normalized[i][2];
-
-                G1 += x1 * x1 + y1 * y1 + z1 * z1;
-                G2 += x2 * x2 + y2 * y2 + z2 * z2;
-        }
-        double E0 = (G1 + G2) / 2;
-
-        for (int i = 0;i<s->num_graphs;i++)
+        bool found_graph = false, improved = false;
+        for (int i = 0;i<num_entries;i++)
         {
-                if (hash != s->graphs[i].hash)
+                //refdata_t objects are defined per translation unit, so compare types rather than pointers
+                const refdata_t* s = NULL;
+                for (int k=0;k<num_structures;k++)
+                        if (structures[k]->type == entries[i].ref->type)
+                                s = structures[k];
+
+                if (s == NULL)
                         continue;
 
-                graph_t* gref = &s->graphs[i];
-                for (int j = 0;j<gref->num_automorphisms;j++)
-                {
-                        for (int k=0;k<num_points;k++)
-                                mapping[automorphisms[gref->automorphism_index + j][k]] = inverse_labelling[ gref->canonical_labelling[k] ];
+                found_graph = true;
+                const double (*ideal_points)[3] = s->points;
+                double G1 = sum_of_squares(num_points, ideal_points);
+                double E0 = (G1 + G2) / 2;
 
-                        double q[4], scale = 0;
-                        double rmsd = calc_rmsd(num_points, ideal_points, normalized, mapping, G1, G2, E0, q, &scale);
-                        if (rmsd < res->rmsd)
+                //the automorphisms are evaluated a vector of lanes at a time
+                const graph_t* gref = entries[i].graph;
+                int block_size = single_precision ? PTM_NUM_FLOAT_LANES : PTM_NUM_LANES;
+                for (int j0 = 0;j0<gref->num_automorphisms;j0+=block_size)
+                {
+                        int num_lanes = std::min(block_size, gref->num_automorphisms - j0);
+                        for (int j=0;j<num_lanes;j++)
+                                for (int k=0;k<num_points;k++)
+                                        mappings[j][automorphisms[gref->automorphism_index + j0 + j][k]] = inverse_labelling[ gref->canonical_labelling[k] ];
+
+                        //most graphs of distorted environments have a single automorphism
+                        double A[PTM_NUM_LANES][9], lambda[PTM_NUM_FLOAT_LANES];
+                        if (num_lanes == 1)
+                        {
+                                InnerProduct(A[0], num_points, ideal_points, normalized, mappings[0]);
+                                lambda[0] = FastCalcMaxEigenvalue(A[0], E0);
+                                improved |= check_mapping(s, num_points, normalized, mappings[0], A[0], lambda[0], G1, G2, E0, res);
+                        }
+                        else if (single_precision)
+                        {
+                                //the tolerance covers the error of the single precision residual
+                                const double float_tolerance = 1E-3;
+                                multi_eigenvalue_float(num_points, ideal_points, normalized, num_lanes, mappings, E0, lambda);
+                                for (int j=0;j<num_lanes;j++)
+                                {
+                                        double residual = G1 - lambda[j] * lambda[j] / G2;
+                                        if (residual > num_points * res->rmsd * res->rmsd + float_tolerance * G1)
+                                                continue;
+
+                                        InnerProduct(A[0], num_points, ideal_points, normalized, mappings[j]);
+                                        lambda[j] = FastCalcMaxEigenvalue(A[0], E0);
+                                        improved |= check_mapping(s, num_points, normalized, mappings[j], A[0], lambda[j], G1, G2, E0, res);
+                                }
+                        }
+                        else
                         {
-                                res->rmsd = rmsd;
-                                res->scale = scale;
-                                res->ref_struct = s;
-                                memcpy(res->q, q, 4 * sizeof(double));
-                                memcpy(res->mapping, mapping, sizeof(int8_t) * num_points);
+                                multi_inner_product_eigenvalue(num_points, ideal_points, normalized, num_lanes, mappings, E0, A, lambda);
+                                for (int j=0;j<num_lanes;j++)
+                                        improved |= check_mapping(s, num_points, normalized, mappings[j], A[j], lambda[j], G1, G2, E0, res);
                         }
                 }
         }
+
+        if (!found_graph)
+                PTM_STATS_COUNT(res->stats, rejected[PTM_REJECT_HASH]);
+        else if (!improved)
+                PTM_STATS_COUNT(res->stats, rejected[PTM_REJECT_RMSD]);
 }
 
-int match_general(const refdata_t* s, double (*ch_points)[3], double (*points)[3], convexhull_t* ch, result_t* res)
+bool match_mapping(const refdata_t* s, double (*points)[3], int8_t* mapping, result_t* res)
+{
+        int num_points = s->num_nbrs + 1;
+        double normalized[PTM_MAX_POINTS][3];
+        subtract_barycentre(num_points, points, normalized);
+
+        double G1 = sum_of_squares(num_points, s->points);
+        double G2 = sum_of_squares(num_points, normalized);
+        double E0 = (G1 + G2) / 2;
+
+        PTM_STATS_START(check_start);
+        double A[9];
+        InnerProduct(A, num_points, s->points, normalized, mapping);
+        double lambda = FastCalcMaxEigenvalue(A, E0);
+        bool improved = check_mapping(s, num_points, normalized, mapping, A, lambda, G1, G2, E0, res);
+        PTM_STATS_STOP(res->stats, PTM_STAGE_CHECK_GRAPHS, check_start);
+        return improved;
+}
+
+int match_general(const refdata_t* s, double (*ch_points)[3], double (*points)[3], int32_t flags, convexhull_t* ch, result_t* res)
 {
         int8_t degree[PTM_MAX_NBRS];
         int8_t facets[PTM_MAX_FACETS][3];
 
+        PTM_STATS_START(hull_start);
         int ret = get_convex_hull(s->num_nbrs + 1, (const double (*)[3])ch_points, ch, facets);
+        PTM_STATS_STOP(res->stats, PTM_STAGE_CONVEX_HULL, hull_start);
         ch->ok = ret >= 0;
         if (ret != 0)
+        {
+                PTM_STATS_COUNT(res->stats, rejected[PTM_REJECT_FACETS]);
                 return PTM_NO_ERROR;
+        }
 
         if (ch->num_facets != s->num_facets)
+        {
+                PTM_STATS_COUNT(res->stats, rejected[PTM_REJECT_FACETS]);
                 return PTM_NO_ERROR;                        //incorrect number of facets in convex hull
+        }
 
         int max_degree = graph_degree(s->num_facets, facets, s->num_nbrs, degree);
         if (max_degree > s->max_degree)
+        {
+                PTM_STATS_COUNT(res->stats, rejected[PTM_REJECT_DEGREE]);
                 return PTM_NO_ERROR;
+        }
 
         if (s->type == PTM_MATCH_SC)
                 for (int i = 0;i<s->num_nbrs;i++)
                         if (degree[i] != 4)
+                        {
+                                PTM_STATS_COUNT(res->stats, rejected[PTM_REJECT_DEGREE]);
                                 return PTM_NO_ERROR;
+                        }
 
         double normalized[PTM_MAX_POINTS][3];
         subtract_barycentre(s->num_nbrs + 1, points, normalized);
@@ -137,11 +241,15 @@ int match_general(const refdata_t* s, double (*ch_points)[3], double (*points)[3
         int8_t colours[PTM_MAX_POINTS] = {0};
         int8_t canonical_labelling[PTM_MAX_POINTS];
         uint64_t hash = 0;
+        PTM_STATS_START(canonical_start);
         ret = canonical_form_coloured(s->num_facets, facets, s->num_nbrs, degree, colours, canonical_labelling, &code[0], &hash);
+        PTM_STATS_STOP(res->stats, PTM_STAGE_CANONICAL, canonical_start);
         if (ret != PTM_NO_ERROR)
                 return ret;
 
-        check_graphs(s, hash, canonical_labelling, normalized, res);
+        PTM_STATS_START(check_start);
+        check_graphs(1, &s, hash, canonical_labelling, normalized, flags & PTM_SINGLE_PRECISION, res);
+        PTM_STATS_STOP(res->stats, PTM_STAGE_CHECK_GRAPHS, check_start);
         return PTM_NO_ERROR;
 }
 
@@ -154,17 +262,28 @@ int match_fcc_hcp_ico(double (*ch_points)[3], double (*points)[3], int32_t flags
         int8_t degree[PTM_MAX_NBRS];
         int8_t facets[PTM_MAX_FACETS][3];
 
+        PTM_STATS_START(hull_start);
         int ret = get_convex_hull(num_nbrs + 1, (const double (*)[3])ch_points, ch, facets);
+        PTM_STATS_STOP(res->stats, PTM_STAGE_CONVEX_HULL, hull_start);
         ch->ok = ret >= 0;
         if (ret != 0)
+        {
+                PTM_STATS_COUNT(res->stats, rejected[PTM_REJECT_FACETS]);
                 return PTM_NO_ERROR;
+        }
 
         if (ch->num_facets != num_facets)
+        {
+                PTM_STATS_COUNT(res->stats, rejected[PTM_REJECT_FACETS]);
                 return PTM_NO_ERROR;                        //incorrect number of facets in convex hull
+        }
 
         int _max_degree = graph_degree(num_facets, facets, num_nbrs, degree);
         if (_max_degree > max_degree)
+        {
+                PTM_STATS_COUNT(res->stats, rejected[PTM_REJECT_DEGREE]);
                 return PTM_NO_ERROR;
+        }
 
         double normalized[PTM_MAX_POINTS][3];
         subtract_barycentre(num_nbrs + 1, points, normalized);
@@ -173,13 +292,21 @@ int match_fcc_hcp_ico(double (*ch_points)[3], double (*points)[3], int32_t flags
         int8_t colours[PTM_MAX_POINTS] = {0};
         int8_t canonical_labelling[PTM_MAX_POINTS];
         uint64_t hash = 0;
+        PTM_STATS_START(canonical_start);
         ret = canonical_form_coloured(num_facets, facets, num_nbrs, degree, colours, canonical_labelling, &code[0], &hash);
+        PTM_STATS_STOP(res->stats, PTM_STAGE_CANONICAL, canonical_start);
         if (ret != PTM_NO_ERROR)
                 return ret;
 
-        if (flags & PTM_CHECK_FCC)        check_graphs(&structure_fcc, hash, canonical_labelling, normalized, res);
-        if (flags & PTM_CHECK_HCP)        check_graphs(&structure_hcp, hash, canonical_labelling, normalized, res);
-        if (flags & PTM_CHECK_ICO)        check_graphs(&structure_ico, hash, canonical_labelling, normalized, res);
+        int num_structures = 0;
+        const refdata_t* structures[3];
+        if (flags & PTM_CHECK_FCC)        structures[num_structures++] = &structure_fcc;
+        if (flags & PTM_CHECK_HCP)        structures[num_structures++] = &structure_hcp;
+        if (flags & PTM_CHECK_ICO)        structures[num_structures++] = &structure_ico;
+
+        PTM_STATS_START(check_start);
+        check_graphs(num_structures, structures, hash, canonical_labelling, normalized, flags & PTM_SINGLE_PRECISION, res);
+        PTM_STATS_STOP(res->stats, PTM_STAGE_CHECK_GRAPHS, check_start);
         return PTM_NO_ERROR;
 }
 
@@ -191,10 +318,15 @@ int match_dcub_dhex(double (*ch_points)[3], double (*points)[3], int32_t flags,
 
 
         int8_t facets[PTM_MAX_FACETS][3];
+        PTM_STATS_START(hull_start);
         int ret = get_convex_hull(num_nbrs + 1, (const double (*)[3])ch_points, ch, facets);
+        PTM_STATS_STOP(res->stats, PTM_STAGE_CONVEX_HULL, hull_start);
         ch->ok = ret >= 0;
         if (ret != 0)
+        {
+                PTM_STATS_COUNT(res->stats, rejected[PTM_REJECT_FACETS]);
                 return PTM_NO_ERROR;
+        }
 
         //check for facets with multiple inner atoms
         bool inverted[4] = {false, false, false, false};
@@ -210,7 +342,10 @@ int match_dcub_dhex(double (*ch_points)[3], double (*points)[3], int32_t flags,
                         }
                 }
                 if (n > 1)
+                {
+                        PTM_STATS_COUNT(res->stats, rejected[PTM_REJECT_FACETS]);
                         return PTM_NO_ERROR;
+                }
         }
 
         int num_inverted = 0;
@@ -218,12 +353,18 @@ int match_dcub_dhex(double (*ch_points)[3], double (*points)[3], int32_t flags,
                 num_inverted += inverted[i] ? 1 : 0;
 
         if (ch->num_facets != num_facets + 2 * num_inverted)
+        {
+                PTM_STATS_COUNT(res->stats, rejected[PTM_REJECT_FACETS]);
                 return PTM_NO_ERROR;                        //incorrect number of facets in convex hull
+        }
 
         int8_t degree[PTM_MAX_NBRS];
         int _max_degree = graph_degree(num_facets, facets, num_nbrs, degree);
         if (_max_degree > max_degree)
+        {
+                PTM_STATS_COUNT(res->stats, rejected[PTM_REJECT_DEGREE]);
                 return PTM_NO_ERROR;
+        }
 
         int num_found = 0;
         int8_t toadd[4][3];
@@ -242,7 +383,10 @@ int match_dcub_dhex(double (*ch_points)[3], double (*points)[3], int32_t flags,
                 if (i0 == i1 && i0 == i2)
                 {
                         if (num_found + num_inverted >= 4)
+                        {
+                                PTM_STATS_COUNT(res->stats, rejected[PTM_REJECT_FACETS]);
                                 return PTM_NO_ERROR;
+                        }
 
                         toadd[num_found][0] = a;
                         toadd[num_found][1] = b;
@@ -256,7 +400,10 @@ int match_dcub_dhex(double (*ch_points)[3], double (*points)[3], int32_t flags,
         }
 
         if (num_found + num_inverted != 4)
+        {
+                PTM_STATS_COUNT(res->stats, rejected[PTM_REJECT_FACETS]);
                 return PTM_NO_ERROR;
+        }
 
         for (int i=0;i<num_found;i++)
         {
@@ -284,7 +431,10 @@ int match_dcub_dhex(double (*ch_points)[3], double (*points)[3], int32_t flags,
 
         _max_degree = graph_degree(ch->num_facets, facets, num_nbrs, degree);
         if (_max_degree > max_degree)
+        {
+                PTM_STATS_COUNT(res->stats, rejected[PTM_REJECT_DEGREE]);
                 return PTM_NO_ERROR;
+        }
 
         double normalized[PTM_MAX_POINTS][3];
         subtract_barycentre(num_nbrs + 1, points, normalized);
@@ -293,17 +443,25 @@ int match_dcub_dhex(double (*ch_points)[3], double (*points)[3], int32_t flags,
         int8_t colours[PTM_MAX_POINTS] = {1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
         int8_t canonical_labelling[PTM_MAX_POINTS];
         uint64_t hash = 0;
+        PTM_STATS_START(canonical_start);
         ret = canonical_form_coloured(ch->num_facets, facets, num_nbrs, degree, colours, canonical_labelling, &code[0], &hash);
+        PTM_STATS_STOP(res->stats, PTM_STAGE_CANONICAL, canonical_start);
         if (ret != PTM_NO_ERROR)
                 return ret;
 
-        if (flags & PTM_CHECK_DCUB)        check_graphs(&structure_dcub, hash, canonical_labelling, normalized, res);
-        if (flags & PTM_CHECK_DHEX)        check_graphs(&structure_dhex, hash, canonical_labelling, normalized, res);
+        int num_structures = 0;
+        const refdata_t* structures[2];
+        if (flags & PTM_CHECK_DCUB)        structures[num_structures++] = &structure_dcub;
+        if (flags & PTM_CHECK_DHEX)        structures[num_structures++] = &structure_dhex;
+
+        PTM_STATS_START(check_start);
+        check_graphs(num_structures, structures, hash, canonical_labelling, normalized, flags & PTM_SINGLE_PRECISION, res);
+        PTM_STATS_STOP(res->stats, PTM_STAGE_CHECK_GRAPHS, check_start);
 
         return PTM_NO_ERROR;
 }
 
-static void check_graphs_graphene(        const refdata_t* s,
+static bool check_graphs_graphene(        const refdata_t* s,
                                         int num_points,
                                         const double (*ideal_points)[3],
                                         double (*normalized)[3],
@@ -326,16 +484,21 @@ static void check_graphs_graphene(        const refdata_t* s,
         }
         double E0 = (G1 + G2) / 2;
 
-        double q[4], scale = 0;
-        double rmsd = calc_rmsd(num_points, ideal_points, normalized, mapping, G1, G2, E0, q, &scale);
-        if (rmsd < res->rmsd)
-        {
-                res->rmsd = rmsd;
-                res->scale = scale;
-                res->ref_struct = s;
-                memcpy(res->q, q, 4 * sizeof(double));
-                memcpy(res->mapping, mapping, sizeof(int8_t) * num_points);
-        }
+        double A0[9];
+        InnerProduct(A0, num_points, ideal_points, normalized, mapping);
+        double lambda = FastCalcMaxEigenvalue(A0, E0);
+
+        double q[4], scale = 0, rmsd = INFINITY;
+        bool ok = calc_rmsd(num_points, ideal_points, normalized, mapping, A0, lambda, G1, G2, E0, res->rmsd, &rmsd, q, &scale);
+        if (!ok || !(rmsd < res->rmsd))
+                return false;
+
+        res->rmsd = rmsd;
+        res->scale = scale;
+        res->ref_struct = s;
+        memcpy(res->q, q, 4 * sizeof(double));
+        memcpy(res->mapping, mapping, sizeof(int8_t) * num_points);
+        return true;
 }
 
 int match_graphene(double (*points)[3], result_t* res)
@@ -351,6 +514,8 @@ int match_graphene(double (*points)[3], result_t* res)
         for (int i=0;i<num_points;i++)
                 mapping[i] = i;
 
+        PTM_STATS_START(check_start);
+        bool improved = false;
         for (int i=0;i<2;i++)
         {
                 std::swap(mapping[4], mapping[5]);
@@ -363,11 +528,15 @@ int match_graphene(double (*points)[3], result_t* res)
                         {
                                 std::swap(mapping[8], mapping[9]);
 
-                                check_graphs_graphene(&structure_graphene, num_points, ideal_points, normalized, mapping, res);
+                                improved |= check_graphs_graphene(&structure_graphene, num_points, ideal_points, normalized, mapping, res);
                         }
                 }
         }
 
+        PTM_STATS_STOP(res->stats, PTM_STAGE_CHECK_GRAPHS, check_start);
+        if (!improved)
+                PTM_STATS_COUNT(res->stats, rejected[PTM_REJECT_RMSD]);
+
         return PTM_NO_ERROR;
 }
 
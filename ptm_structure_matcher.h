@@ -12,6 +12,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include "ptm_initialize_data.h"
 #include "ptm_constants.h"
+#include "ptm_functions.h"
 
 
 namespace ptm {
@@ -23,13 +24,17 @@ typedef struct
         double q[4];                //rotation in quaternion form (rigid body transformation)
         int8_t mapping[PTM_MAX_POINTS];
         const refdata_t* ref_struct;
+        ptm_stats_t* stats;         //NULL if statistics are not gathered
 } result_t;
 
-int match_general(const refdata_t* s, double (*ch_points)[3], double (*points)[3], convexhull_t* ch, result_t* res);
+int match_general(const refdata_t* s, double (*ch_points)[3], double (*points)[3], int32_t flags, convexhull_t* ch, result_t* res);
 int match_fcc_hcp_ico(double (*ch_points)[3], double (*points)[3], int32_t flags, convexhull_t* ch, result_t* res);
 int match_dcub_dhex(double (*ch_points)[3], double (*points)[3], int32_t flags, convexhull_t* ch, result_t* res);
 int match_graphene(double (*points)[3], result_t* res);
 
+//evaluates a single known mapping, without the convex hull or graph matching; returns true if it improves on res
+bool match_mapping(const refdata_t* s, double (*points)[3], int8_t* mapping, result_t* res);
+
 }
 
 #endif
@@ -1403,6 +1403,45 @@ void voronoicell_neighbor::neighbors(std::vector<int> &v) {
         reset_edges();
 }
 
+/** Computes the neighbor IDs and the vertices of every face in a single pass,
+ * writing into fixed-size arrays so that no memory is allocated.
+ * \param[in] max_faces the capacity of nbrs.
+ * \param[in] max_size the capacity of v.
+ * \param[out] nbrs the neighbor ID of each face.
+ * \param[out] v the vertices of each face, in the format of face_vertices().
+ * \return The number of faces, or -1 if the arrays are too small. */
+int voronoicell_neighbor::face_list(int max_faces,int max_size,int *nbrs,int *v) {
+        int i,j,k,l,m,s=0,vp=0,vn;
+        bool overflow=false;
+        for(i=1;i<p;i++) for(j=0;j<nu[i];j++) {
+                k=ed[i][j];
+                if(k>=0) {
+                        if(s>=max_faces||vp+2>max_size) overflow=true;
+                        if(!overflow) {
+                                nbrs[s]=ne[i][j];
+                                v[vp+1]=i;
+                        }
+                        s++;
+                        vn=vp+2;
+                        ed[i][j]=-1-k;
+                        l=cycle_up(ed[i][nu[i]+j],k);
+                        do {
+                                if(vn>=max_size) overflow=true;
+                                if(!overflow) v[vn]=k;
+                                vn++;
+                                m=ed[k][l];
+                                ed[k][l]=-1-m;
+                                l=cycle_up(ed[k][nu[k]+l],m);
+                                k=m;
+                        } while (k!=i);
+                        if(!overflow) v[vp]=vn-vp-1;
+                        vp=vn;
+                }
+        }
+        reset_edges();
+        return overflow?-1:s;
+}
+
 /** Returns the number of faces of a computed Voronoi cell.
  * \return The number of faces. */
 int voronoicell_base::number_of_faces() {
@@ -324,6 +324,7 @@ class voronoicell_neighbor : public voronoicell_base {
                 void init(double xmin,double xmax,double ymin,double ymax,double zmin,double zmax);
                 void check_facets();
                 virtual void neighbors(std::vector<int> &v);
+                int face_list(int max_faces,int max_size,int *nbrs,int *v);
 
         private:
                 int *paux1;
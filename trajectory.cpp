@@ -0,0 +1,461 @@
+/*Copyright (c) 2016 PM Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+#include <cinttypes>
+#include <algorithm>
+#include "trajectory.hpp"
+
+/*
+	Frame by frame readers for LAMMPS text and binary dumps and extended XYZ files.  Only the
+	positions, the cell and the LAMMPS atom ids are read.  LAMMPS dumps are not sorted by default,
+	so their atoms are put in the order of their ids, and a frame without ids or with a repeated
+	id is rejected; extended XYZ atoms are kept in the order of the file.  LAMMPS binary dumps
+	written before the column names were added to the header are assumed to hold "id type x y z".
+*/
+
+static bool read_line(trajectory_t* t)
+{
+	ssize_t n = getline(&t->line, &t->line_capacity, t->file);
+	if (n < 0)
+		return false;
+
+	while (n > 0 && (t->line[n - 1] == '\n' || t->line[n - 1] == '\r'))
+		t->line[--n] = '\0';
+	return true;
+}
+
+static bool read_binary(trajectory_t* t, void* data, size_t size)
+{
+	return fread(data, size, 1, t->file) == 1;
+}
+
+//reads the values in columns cols[0..num_cols-1] of a whitespace separated line
+static bool parse_columns(const char* s, int num_cols, const int* cols, double* x)
+{
+	int max_col = *std::max_element(cols, cols + num_cols);
+	const char* p = s;
+	for (int c=0;c<=max_col;c++)
+	{
+		while (isspace((unsigned char)*p))
+			p++;
+		if (*p == '\0')
+			return false;
+
+		for (int k=0;k<num_cols;k++)
+			if (cols[k] == c)
+				x[k] = strtod(p, NULL);
+
+		while (*p != '\0' && !isspace((unsigned char)*p))
+			p++;
+	}
+
+	return true;
+}
+
+//finds the position columns, and the id column as cols[3], among the column names; scaled positions
+//are fractions of the cell vectors
+static bool find_columns(char* names, int* cols, bool* scaled)
+{
+	const char* candidates[4][3] = {{"x", "y", "z"}, {"xu", "yu", "zu"}, {"xs", "ys", "zs"}, {"xsu", "ysu", "zsu"}};
+	int found[4][3];
+	memset(found, -1, sizeof(found));
+
+	char* save = NULL;
+	int index = 0;
+	cols[3] = -1;
+	for (char* token = strtok_r(names, " \t", &save); token != NULL; token = strtok_r(NULL, " \t", &save), index++)
+	{
+		if (strcmp(token, "id") == 0)
+			cols[3] = index;
+
+		for (int g=0;g<4;g++)
+			for (int k=0;k<3;k++)
+				if (strcmp(token, candidates[g][k]) == 0)
+					found[g][k] = index;
+	}
+
+	if (cols[3] < 0)
+		return false;
+
+	for (int g=0;g<4;g++)
+	{
+		if (found[g][0] >= 0 && found[g][1] >= 0 && found[g][2] >= 0)
+		{
+			memcpy(cols, found[g], 3 * sizeof(int));
+			*scaled = g >= 2;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+//converts LAMMPS box bounds to cell vectors; the bounds of a triclinic box are those of its bounding box
+static void lammps_cell(const double* lo, const double* hi, const double* tilt, bool triclinic, double* cell, double* origin)
+{
+	double xy = triclinic ? tilt[0] : 0, xz = triclinic ? tilt[1] : 0, yz = triclinic ? tilt[2] : 0;
+	double xlo = lo[0] - std::min(std::min(0.0, xy), std::min(xz, xy + xz));
+	double xhi = hi[0] - std::max(std::max(0.0, xy), std::max(xz, xy + xz));
+	double ylo = lo[1] - std::min(0.0, yz);
+	double yhi = hi[1] - std::max(0.0, yz);
+
+	double rows[9] = {	xhi - xlo, 0, 0,
+				xy, yhi - ylo, 0,
+				xz, yz, hi[2] - lo[2]};
+	memcpy(cell, rows, 9 * sizeof(double));
+	origin[0] = xlo;
+	origin[1] = ylo;
+	origin[2] = lo[2];
+}
+
+static void unscale(const double* cell, const double* origin, double* x)
+{
+	double s[3] = {x[0], x[1], x[2]};
+	for (int k=0;k<3;k++)
+		x[k] = origin[k] + s[0] * cell[0 * 3 + k] + s[1] * cell[1 * 3 + k] + s[2] * cell[2 * 3 + k];
+}
+
+//puts the atoms of a LAMMPS frame in the order of their ids; fails if an id is repeated
+static bool sort_by_id(trajectory_t* t, frame_t* frame)
+{
+	size_t num = frame->ids.size();
+	t->order.resize(num);
+	for (size_t i=0;i<num;i++)
+		t->order[i] = std::make_pair(frame->ids[i], i);
+	std::sort(t->order.begin(), t->order.end());
+
+	t->sorted.resize(3 * num);
+	for (size_t i=0;i<num;i++)
+	{
+		if (i > 0 && t->order[i].first == t->order[i - 1].first)
+			return false;
+
+		size_t j = t->order[i].second;
+		frame->ids[i] = t->order[i].first;
+		memcpy(&t->sorted[3 * i], &frame->positions[3 * j], 3 * sizeof(double));
+	}
+
+	frame->positions.swap(t->sorted);
+	return true;
+}
+
+static int read_lammps_text(trajectory_t* t, frame_t* frame)
+{
+	if (!read_line(t))
+		return 0;
+
+	long long timestep = 0;
+	unsigned long long num_atoms = 0;
+	if (strncmp(t->line, "ITEM: TIMESTEP", 14) != 0 || !read_line(t) || sscanf(t->line, "%lld", &timestep) != 1)
+		return -1;
+
+	if (!read_line(t) || strncmp(t->line, "ITEM: NUMBER OF ATOMS", 21) != 0 || !read_line(t) || sscanf(t->line, "%llu", &num_atoms) != 1)
+		return -1;
+
+	//"ITEM: BOX BOUNDS [xy xz yz] xx yy zz", where the boundary flags of periodic directions are "pp"
+	if (!read_line(t) || strncmp(t->line, "ITEM: BOX BOUNDS", 16) != 0)
+		return -1;
+
+	bool triclinic = strstr(t->line, "xy xz yz") != NULL;
+	frame->pbc[0] = frame->pbc[1] = frame->pbc[2] = true;
+	char* save = NULL;
+	int num_flags = 0;
+	for (char* token = strtok_r(t->line + 16, " \t", &save); token != NULL; token = strtok_r(NULL, " \t", &save))
+	{
+		if (strcmp(token, "xy") == 0 || strcmp(token, "xz") == 0 || strcmp(token, "yz") == 0)
+			continue;
+		if (num_flags < 3)
+			frame->pbc[num_flags++] = token[0] == 'p';
+	}
+
+	double lo[3], hi[3], tilt[3] = {0, 0, 0};
+	for (int k=0;k<3;k++)
+	{
+		if (!read_line(t) || sscanf(t->line, "%lf %lf %lf", &lo[k], &hi[k], &tilt[k]) < 2)
+			return -1;
+	}
+
+	double origin[3];
+	lammps_cell(lo, hi, tilt, triclinic, frame->cell, origin);
+	frame->has_cell = true;
+	frame->timestep = timestep;
+
+	int cols[4];
+	bool scaled = false;
+	if (!read_line(t) || strncmp(t->line, "ITEM: ATOMS", 11) != 0 || !find_columns(t->line + 11, cols, &scaled))
+		return -1;
+
+	frame->positions.resize(3 * num_atoms);
+	frame->ids.resize(num_atoms);
+	for (size_t i=0;i<num_atoms;i++)
+	{
+		double values[4];
+		if (!read_line(t) || !parse_columns(t->line, 4, cols, values))
+			return -1;
+
+		double* x = &frame->positions[3 * i];
+		memcpy(x, values, 3 * sizeof(double));
+		frame->ids[i] = (int64_t)values[3];
+		if (scaled)
+			unscale(frame->cell, origin, x);
+	}
+
+	return sort_by_id(t, frame) ? 1 : -1;
+}
+
+static int read_lammps_binary(trajectory_t* t, frame_t* frame)
+{
+	int64_t timestep = 0;
+	if (!read_binary(t, &timestep, sizeof(int64_t)))
+		return 0;
+
+	//newer dumps start each frame with a negated length, a magic string, the endianness and a revision
+	bool has_columns = timestep < 0;
+	if (has_columns)
+	{
+		char magic[64];
+		int endian = 0, revision = 0;
+		if (-timestep >= (int64_t)sizeof(magic) || !read_binary(t, magic, -timestep))
+			return -1;
+		if (!read_binary(t, &endian, sizeof(int)) || !read_binary(t, &revision, sizeof(int)) || endian != 1)
+			return -1;
+		if (!read_binary(t, &timestep, sizeof(int64_t)))
+			return -1;
+	}
+
+	int64_t num_atoms = 0;
+	int triclinic = 0, boundary[6], size_one = 0;
+	double bounds[6], tilt[3] = {0, 0, 0};
+	if (	   !read_binary(t, &num_atoms, sizeof(int64_t)) || !read_binary(t, &triclinic, sizeof(int))
+		|| !read_binary(t, boundary, sizeof(boundary)) || !read_binary(t, bounds, sizeof(bounds))
+		|| (triclinic && !read_binary(t, tilt, sizeof(tilt)))
+		|| !read_binary(t, &size_one, sizeof(int)))
+		return -1;
+
+	if (num_atoms < 0 || size_one <= 0)
+		return -1;
+
+	int cols[4] = {2, 3, 4, 0};
+	bool scaled = false;
+	if (has_columns)
+	{
+		//unit style and time are skipped
+		int len = 0;
+		char time_flag = 0;
+		double time;
+		if (!read_binary(t, &len, sizeof(int)) || len < 0 || fseek(t->file, len, SEEK_CUR) != 0)
+			return -1;
+		if (!read_binary(t, &time_flag, sizeof(char)) || (time_flag && !read_binary(t, &time, sizeof(double))))
+			return -1;
+		if (!read_binary(t, &len, sizeof(int)) || len <= 0)
+			return -1;
+
+		std::vector<char> names(len + 1, '\0');
+		if (!read_binary(t, names.data(), len) || !find_columns(names.data(), cols, &scaled))
+			return -1;
+	}
+
+	if (*std::max_element(cols, cols + 4) >= size_one)
+		return -1;
+
+	int num_chunks = 0;
+	if (!read_binary(t, &num_chunks, sizeof(int)) || num_chunks < 0)
+		return -1;
+
+	double lo[3] = {bounds[0], bounds[2], bounds[4]};
+	double hi[3] = {bounds[1], bounds[3], bounds[5]};
+	double origin[3];
+	lammps_cell(lo, hi, tilt, triclinic != 0, frame->cell, origin);
+	for (int k=0;k<3;k++)
+		frame->pbc[k] = boundary[2 * k] == 0;
+	frame->has_cell = true;
+	frame->timestep = timestep;
+
+	//the atoms are written in chunks, one per writing process
+	frame->positions.resize(3 * num_atoms);
+	frame->ids.resize(num_atoms);
+	int64_t num_read = 0;
+	for (int c=0;c<num_chunks;c++)
+	{
+		int n = 0;
+		if (!read_binary(t, &n, sizeof(int)) || n < 0 || n % size_one != 0 || num_read + n / size_one > num_atoms)
+			return -1;
+
+		t->chunk.resize(n);
+		if (n > 0 && !read_binary(t, t->chunk.data(), n * sizeof(double)))
+			return -1;
+
+		for (int i=0;i<n/size_one;i++)
+		{
+			const double* row = &t->chunk[i * size_one];
+			frame->ids[num_read] = (int64_t)row[cols[3]];
+			double* x = &frame->positions[3 * num_read++];
+			for (int k=0;k<3;k++)
+				x[k] = row[cols[k]];
+
+			if (scaled)
+				unscale(frame->cell, origin, x);
+		}
+	}
+
+	return num_read == num_atoms && sort_by_id(t, frame) ? 1 : -1;
+}
+
+//finds the value of key=value or key="value" in an extended XYZ comment line
+static bool find_value(const char* line, const char* key, char* value, size_t size)
+{
+	size_t length = strlen(key);
+	for (const char* p=line;(p = strstr(p, key)) != NULL;p++)
+	{
+		if ((p != line && !isspace((unsigned char)p[-1])) || p[length] != '=')
+			continue;
+
+		p += length + 1;
+		char end = ' ';
+		if (*p == '"')
+		{
+			end = '"';
+			p++;
+		}
+
+		size_t n = 0;
+		while (p[n] != '\0' && p[n] != end && n + 1 < size)
+			n++;
+
+		memcpy(value, p, n);
+		value[n] = '\0';
+		return true;
+	}
+
+	return false;
+}
+
+static int read_extxyz(trajectory_t* t, frame_t* frame)
+{
+	if (!read_line(t))
+		return 0;
+
+	unsigned long long num_atoms = 0;
+	if (sscanf(t->line, "%llu", &num_atoms) != 1 || !read_line(t))
+		return -1;
+
+	char value[1024];
+	frame->timestep = -1;
+	if (find_value(t->line, "Timestep", value, sizeof(value)) || find_value(t->line, "timestep", value, sizeof(value)))
+		frame->timestep = strtoll(value, NULL, 10);
+
+	frame->has_cell = find_value(t->line, "Lattice", value, sizeof(value));
+	if (frame->has_cell)
+	{
+		double* c = frame->cell;
+		if (sscanf(value, "%lf %lf %lf %lf %lf %lf %lf %lf %lf", &c[0], &c[1], &c[2], &c[3], &c[4], &c[5], &c[6], &c[7], &c[8]) != 9)
+			return -1;
+	}
+
+	frame->pbc[0] = frame->pbc[1] = frame->pbc[2] = frame->has_cell;
+	if (frame->has_cell && find_value(t->line, "pbc", value, sizeof(value)))
+	{
+		const char* p = value;
+		for (int k=0;k<3;k++)
+		{
+			while (isspace((unsigned char)*p))
+				p++;
+			frame->pbc[k] = *p == 'T' || *p == 't' || *p == '1';
+			if (*p != '\0')
+				p++;
+		}
+	}
+
+	//Properties=name:type:count:... gives the columns; plain XYZ files have the species and then the positions
+	int cols[3] = {1, 2, 3};
+	if (find_value(t->line, "Properties", value, sizeof(value)))
+	{
+		bool found = false;
+		int column = 0;
+		char* save = NULL;
+		for (char* name = strtok_r(value, ":", &save); name != NULL && !found; name = strtok_r(NULL, ":", &save))
+		{
+			char* type = strtok_r(NULL, ":", &save);
+			char* count = strtok_r(NULL, ":", &save);
+			if (type == NULL || count == NULL)
+				return -1;
+
+			found = strcmp(name, "pos") == 0;
+			if (!found)
+				column += atoi(count);
+		}
+
+		if (!found)
+			return -1;
+
+		for (int k=0;k<3;k++)
+			cols[k] = column + k;
+	}
+
+	frame->positions.resize(3 * num_atoms);
+	frame->ids.clear();
+	for (size_t i=0;i<num_atoms;i++)
+		if (!read_line(t) || !parse_columns(t->line, 3, cols, &frame->positions[3 * i]))
+			return -1;
+
+	return 1;
+}
+
+int trajectory_open(const char* path, trajectory_t* t)
+{
+	t->file = fopen(path, "rb");
+	t->line = NULL;
+	t->line_capacity = 0;
+	if (t->file == NULL)
+		return -1;
+
+	//text dumps start with "ITEM:", extended XYZ with the number of atoms; anything else is binary
+	char start[8] = {0};
+	size_t n = fread(start, 1, sizeof(start), t->file);
+	rewind(t->file);
+
+	size_t num_digits = 0;
+	while (num_digits < n && isdigit((unsigned char)start[num_digits]))
+		num_digits++;
+
+	if (n >= 5 && strncmp(start, "ITEM:", 5) == 0)
+		t->format = TRAJECTORY_LAMMPS_TEXT;
+	else if (num_digits > 0 && (num_digits == n || isspace((unsigned char)start[num_digits])))
+		t->format = TRAJECTORY_EXTXYZ;
+	else
+		t->format = TRAJECTORY_LAMMPS_BINARY;
+
+	return 0;
+}
+
+void trajectory_close(trajectory_t* t)
+{
+	if (t->file != NULL)
+		fclose(t->file);
+	free(t->line);
+	t->file = NULL;
+	t->line = NULL;
+	t->line_capacity = 0;
+}
+
+int trajectory_read_frame(trajectory_t* t, frame_t* frame)
+{
+	if (t->format == TRAJECTORY_LAMMPS_TEXT)
+		return read_lammps_text(t, frame);
+	else if (t->format == TRAJECTORY_LAMMPS_BINARY)
+		return read_lammps_binary(t, frame);
+	else
+		return read_extxyz(t, frame);
+}
+
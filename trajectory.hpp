@@ -0,0 +1,53 @@
+/*Copyright (c) 2016 PM Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef TRAJECTORY_HPP
+#define TRAJECTORY_HPP
+
+#include <cstdio>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#define TRAJECTORY_LAMMPS_TEXT		0
+#define TRAJECTORY_LAMMPS_BINARY	1
+#define TRAJECTORY_EXTXYZ		2
+
+//one frame of a trajectory; the buffers are reused from one frame to the next
+typedef struct
+{
+	int64_t timestep;		//-1 if the format has none
+	std::vector<double> positions;	//three per atom, in the order of the ids (LAMMPS) or of the file
+	std::vector<int64_t> ids;	//LAMMPS atom ids in increasing order; empty for extended XYZ
+	bool has_cell;
+	double cell[9];			//cell vectors as rows
+	bool pbc[3];
+} frame_t;
+
+typedef struct
+{
+	FILE* file;
+	int format;
+	char* line;			//line buffer of the text formats
+	size_t line_capacity;
+	std::vector<double> chunk;	//atom data of the binary format
+	std::vector<std::pair<int64_t, size_t> > order;	//id sorting of the LAMMPS formats
+	std::vector<double> sorted;
+} trajectory_t;
+
+//the format is detected from the start of the file
+int trajectory_open(const char* path, trajectory_t* trajectory);
+void trajectory_close(trajectory_t* trajectory);
+
+//returns 1 if a frame was read, 0 at the end of the file and -1 on a malformed frame
+int trajectory_read_frame(trajectory_t* trajectory, frame_t* frame);
+
+#endif
+
@@ -40,11 +40,20 @@ done:
 #include <cassert>
 #include <cmath>
 #include <algorithm>
+#include "ptm_canonical_coloured.h"
+#include "ptm_graph_tools.h"
 #include "ptm_normalize_vertices.h"
 #include "ptm_quat.h"
 #include "ptm_functions.h"
+#include "ptm_graph_index.h"
 
 
+//the graphs as written by datagen/graph_gen.py, from which the graph tables are generated
+namespace rawgraphs {
+using ptm::graph_t;
+#include "datagen/dumped_data.txt"
+}
+
 namespace ptm {
 
 #define RADIANS(x) (2.0 * M_PI * (x) / 360.0)
@@ -446,13 +455,18 @@ typedef struct
 	double dist;
 	double offset[3];
 	int32_t number;
-} sorthelper_t;
+} nbrhelper_t;
 
-static bool sorthelper_compare(sorthelper_t const& a, sorthelper_t const& b)
+static bool nbrhelper_compare(nbrhelper_t const& a, nbrhelper_t const& b)
 {
 	return a.dist < b.dist;
 }
 
+static bool graphentry_compare(graphentry_t const& a, graphentry_t const& b)
+{
+	return a.hash < b.hash;
+}
+
 static int get_neighbours(void* vdata, size_t central_index, size_t atom_index, int num, int* ordering, size_t* output_indices, int32_t* output_numbers, double (*output_pos)[3])
 {
 	unittest_nbrdata_t* nbrdata = (unittest_nbrdata_t*)vdata;
@@ -461,7 +475,7 @@ static int get_neighbours(void* vdata, size_t central_index, size_t atom_index,
 	double (*positions)[3] = nbrdata->positions;
 	int32_t* numbers = nbrdata->numbers;
 
-	sorthelper_t data[PTM_MAX_POINTS];
+	nbrhelper_t data[PTM_MAX_POINTS];
 	for (int i=0;i<num_points;i++)
 	{
 		double x0 = positions[atom_index][0];
@@ -485,7 +499,7 @@ static int get_neighbours(void* vdata, size_t central_index, size_t atom_index,
 			data[i].offset[j] = positions[i][j] - positions[atom_index][j];
 	}
 
-	std::sort(data, data + num_points, &sorthelper_compare);
+	std::sort(data, data + num_points, &nbrhelper_compare);
 
 	int n = std::min(num_points, num);
 	for (int i=0;i<n;i++)
@@ -501,6 +515,85 @@ static int get_neighbours(void* vdata, size_t central_index, size_t atom_index,
 	return n;
 }
 
+static int make_lattice(int num_basis, const double (*basis)[3], int n, double a, double (*positions)[3], double* cell)
+{
+	int num_atoms = 0;
+	for (int i=0;i<n;i++)
+		for (int j=0;j<n;j++)
+			for (int k=0;k<n;k++)
+				for (int b=0;b<num_basis;b++)
+				{
+					positions[num_atoms][0] = (i + basis[b][0]) * a;
+					positions[num_atoms][1] = (j + basis[b][1]) * a;
+					positions[num_atoms][2] = (k + basis[b][2]) * a;
+					num_atoms++;
+				}
+
+	memset(cell, 0, 9 * sizeof(double));
+	cell[0] = cell[4] = cell[8] = n * a;
+	return num_atoms;
+}
+
+//brute force neighbour table for a cubic periodic box
+static void build_neighbour_table(int num_atoms, double (*positions)[3], double length, int max_nbrs, int32_t* nbrs)
+{
+	nbrhelper_t* data = new nbrhelper_t[num_atoms];
+	for (int i=0;i<num_atoms;i++)
+	{
+		int n = 0;
+		for (int j=0;j<num_atoms;j++)
+		{
+			if (j == i)
+				continue;
+
+			double dist = 0;
+			for (int k=0;k<3;k++)
+			{
+				double d = positions[j][k] - positions[i][k];
+				d -= length * round(d / length);
+				dist += d * d;
+			}
+
+			data[n].index = j;
+			data[n].dist = dist;
+			n++;
+		}
+
+		std::sort(data, data + n, &nbrhelper_compare);
+		for (int j=0;j<max_nbrs;j++)
+			nbrs[i * max_nbrs + j] = j < n ? data[j].index : -1;
+	}
+
+	delete[] data;
+}
+
+//brute force minimum image distance, for cells which are large compared to the neighbour distances
+static double image_distance(const double* cell, const bool* pbc, const double* a, const double* b)
+{
+	double best = INFINITY;
+	for (int i=-1;i<=1;i++)
+		for (int j=-1;j<=1;j++)
+			for (int k=-1;k<=1;k++)
+			{
+				int shift[3] = {i, j, k};
+				if ((i && !pbc[0]) || (j && !pbc[1]) || (k && !pbc[2]))
+					continue;
+
+				double dist = 0;
+				for (int l=0;l<3;l++)
+				{
+					double d = b[l] - a[l];
+					for (int m=0;m<3;m++)
+						d += shift[m] * (cell == NULL ? 0 : cell[m * 3 + l]);
+					dist += d * d;
+				}
+
+				best = std::min(best, dist);
+			}
+
+	return best;
+}
+
 uint64_t run_tests()
 {
 	int ret = 0;
@@ -700,11 +793,11 @@ exit(3);*/
 
 				unittest_nbrdata_t nbrlist = {s->num_points, points, numbers};
 
-				int8_t output_indices[PTM_MAX_POINTS];
+				int8_t output_indices[PTM_MAX_INPUT_POINTS];
 				int32_t type, alloy_type;
 				double scale, rmsd, interatomic_distance, lattice_constant;
 				double q[4], F[9], F_res[3], U[9], P[9];
-				ret = ptm_index(local_handle, 0, get_neighbours, (void*)&nbrlist, tocheck, false,
+				ret = ptm_index(local_handle, 0, get_neighbours, (void*)&nbrlist, tocheck, false, INFINITY,
 						&type, &alloy_type, &scale, &rmsd, q, F, F_res, U, P, &interatomic_distance, &lattice_constant, NULL, NULL, output_indices);
 
 				if (ret != PTM_NO_ERROR)
@@ -826,7 +919,7 @@ exit(3);*/
 			double scale, rmsd, interatomic_distance, lattice_constant, q[4];
 
 			unittest_nbrdata_t nbrlist = {s->num_points, pdata[i], NULL};
-			ret = ptm_index(local_handle, 0, get_neighbours, (void*)&nbrlist, s->check, false,
+			ret = ptm_index(local_handle, 0, get_neighbours, (void*)&nbrlist, s->check, false, INFINITY,
 					&type, NULL, &scale, &rmsd, q, NULL, NULL, NULL, NULL, &interatomic_distance, &lattice_constant, NULL, NULL, NULL);
 			if (ret != PTM_NO_ERROR)
 				CLEANUP("indexing failed", ret);
@@ -860,7 +953,7 @@ exit(3);*/
 		memcpy(points, s->points, 3 * sizeof(double) * s->num_points);
 		unittest_nbrdata_t nbrlist = {s->num_points, points, NULL};
 
-		ret = ptm_index(local_handle, 0, get_neighbours, (void*)&nbrlist, s->check, true,
+		ret = ptm_index(local_handle, 0, get_neighbours, (void*)&nbrlist, s->check, true, INFINITY,
 				&type, NULL, &scale, &rmsd, q, F, F_res, NULL, NULL, &interatomic_distance, &lattice_constant, NULL, NULL, NULL);
 		if (ret != PTM_NO_ERROR)
 			CLEANUP("indexing failed", ret);
@@ -898,7 +991,7 @@ exit(3);*/
 			memcpy(points, alt_templates[i], 3 * sizeof(double) * num_points[i]);
 			unittest_nbrdata_t nbrlist = {num_points[i], points, NULL};
 
-			ret = ptm_index(local_handle, 0, get_neighbours, (void*)&nbrlist, checks[i], true,
+			ret = ptm_index(local_handle, 0, get_neighbours, (void*)&nbrlist, checks[i], true, INFINITY,
 					&type, NULL, &scale, &rmsd, q, F, F_res, NULL, NULL, &interatomic_distance, &lattice_constant, NULL, NULL, NULL);
 			if (ret != PTM_NO_ERROR)
 				CLEANUP("indexing failed", ret);
@@ -922,6 +1015,716 @@ exit(3);*/
 		}
 	}
 
+	//remapping a template onto a target orientation, in both orientation conventions, gives a
+	//permutation and orientation that still describe the input points, and the closest orientation
+	//of the symmetry group (found here by brute force)
+	{
+		typedef struct
+		{
+			int num_generators;
+			const double (*generator)[4];
+		} symmetrygroup_t;
+
+		//indexed by [structdata index][output_conventional_orientation]
+		symmetrygroup_t groups[8][2] = {	{{24, generator_cubic},			{24, generator_cubic}},
+							{{6, generator_hcp},			{12, generator_hcp_conventional}},
+							{{24, generator_cubic},			{24, generator_cubic}},
+							{{60, generator_icosahedral},		{60, generator_icosahedral}},
+							{{24, generator_cubic},			{24, generator_cubic}},
+							{{12, generator_diamond_cubic},		{24, generator_cubic}},
+							{{3, generator_diamond_hexagonal},	{12, generator_hcp_conventional}},
+							{{6, generator_hcp},			{12, generator_hcp_conventional}}	};
+
+		double qidentity[4] = {1, 0, 0, 0};
+		for (int it=0;it<num_structures;it++)
+		{
+			structdata_t* s = &structdata[it];
+			for (int conventional=0;conventional<2;conventional++)
+			{
+				//generic orientations, avoiding the symmetry rotations at the start of the test cases
+				for (int iq=4;iq<12;iq++)
+				{
+					//an orientation, and a target taken from further down the test cases
+					double q0[4], qtarget[4], rot[9];
+					memcpy(q0, cubic_qtest[iq].pre, 4 * sizeof(double));
+					memcpy(qtarget, cubic_qtest[iq + 12].pre, 4 * sizeof(double));
+					normalize_quaternion(q0);
+					normalize_quaternion(qtarget);
+
+					double points[PTM_MAX_POINTS][3];
+					quaternion_to_rotation_matrix(q0, rot);
+					for (int i=0;i<s->num_points;i++)
+						matvec(rot, (double*)s->points[i], points[i]);
+
+					for (int use_target=0;use_target<2;use_target++)
+					{
+						double* target = use_target ? qtarget : qidentity;
+						symmetrygroup_t* group = &groups[it][conventional];
+						double expected = INFINITY;
+						for (int k=0;k<group->num_generators;k++)
+						{
+							double qg[4];
+							quat_rot(q0, (double*)group->generator[k], qg);
+							expected = std::min(expected, quat_misorientation(qg, target));
+						}
+
+						double q[4], disorientation = INFINITY;
+						int8_t mapping[PTM_MAX_POINTS];
+						memcpy(q, q0, 4 * sizeof(double));
+						for (int i=0;i<s->num_points;i++)
+							mapping[i] = i;
+
+						const double (*best_template)[3] = NULL;
+						int template_index = ptm_remap_template(	s->type, conventional, 0, use_target ? qtarget : NULL, q,
+												&disorientation, mapping, &best_template);
+						if (template_index < 0 || best_template == NULL)
+							CLEANUP("remapping failed", -1);
+
+						if (!use_target)
+							disorientation = quat_misorientation(q, target);
+
+						if (	   fabs(disorientation - expected) > tolerance
+							|| fabs(disorientation - quat_misorientation(q, target)) > tolerance)
+							CLEANUP("failed on remapped disorientation", -1);
+
+						bool seen[PTM_MAX_POINTS] = {false};
+						for (int i=0;i<s->num_points;i++)
+						{
+							if (mapping[i] < 0 || mapping[i] >= s->num_points || seen[mapping[i]])
+								CLEANUP("failed on remapped permutation", -1);
+							seen[mapping[i]] = true;
+						}
+
+						double A[9];
+						quaternion_to_rotation_matrix(q, A);
+						if (mapped_neighbour_rmsd(s->num_points, 1, A, points, best_template, mapping) > tolerance)
+							CLEANUP("failed on remapped template", -1);
+
+						num_tests++;
+					}
+				}
+			}
+		}
+	}
+
+	//every graph can be found from its canonical hash
+	{
+		for (int t=PTM_MATCH_FCC;t<=PTM_MATCH_DHEX;t++)
+		{
+			const refdata_t* s = refdata[t];
+			for (int i=0;i<s->num_graphs;i++)
+			{
+				const graphentry_t* entries = NULL;
+				int num_entries = find_graphs(s->graphs[i].hash, &entries);
+
+				bool found = false;
+				for (int j=0;j<num_entries;j++)
+					if (entries[j].hash == s->graphs[i].hash && entries[j].graph == &s->graphs[i] && entries[j].ref->type == s->type)
+						found = true;
+
+				if (!found)
+					CLEANUP("failed on graph lookup", -1);
+			}
+		}
+
+		num_tests++;
+	}
+
+	//the generated graph tables match the tables rebuilt from the graphs of graph_gen.py with the
+	//canonical form of this tree, and the hash index is sorted with ties in the order sc, fcc, hcp,
+	//ico, bcc, dcub, dhex
+	{
+		int8_t colours[PTM_MAX_POINTS] = {0};
+		int8_t dcolours[PTM_MAX_POINTS] = {1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+		const int order[] = {PTM_MATCH_SC, PTM_MATCH_FCC, PTM_MATCH_HCP, PTM_MATCH_ICO, PTM_MATCH_BCC, PTM_MATCH_DCUB, PTM_MATCH_DHEX};
+		const graph_t* raw[] = {NULL, rawgraphs::graphs_fcc, rawgraphs::graphs_hcp, rawgraphs::graphs_bcc, rawgraphs::graphs_ico,
+					rawgraphs::graphs_sc, rawgraphs::graphs_dcub, rawgraphs::graphs_dhex};
+
+		if (memcmp(rawgraphs::automorphisms, automorphisms, sizeof(rawgraphs::automorphisms)) != 0)
+			CLEANUP("failed on generated automorphisms", -1);
+
+		graphentry_t rebuilt[PTM_NUM_GRAPHS];
+		int num_rebuilt = 0;
+		for (int k=0;k<7;k++)
+		{
+			const refdata_t* s = refdata[order[k]];
+			int8_t* c = (s->type == PTM_MATCH_DCUB || s->type == PTM_MATCH_DHEX) ? dcolours : colours;
+			for (int i=0;i<s->num_graphs;i++)
+			{
+				const graph_t* g = &s->graphs[i];
+				int8_t facets[PTM_MAX_FACETS][3];
+				memcpy(facets, raw[s->type][i].facets, sizeof(facets));
+
+				double plane_normal[3], origin[3] = {0, 0, 0};
+				for (int j=0;j<s->num_facets;j++)
+					add_facet(&s->points[1], facets[j][0], facets[j][1], facets[j][2], facets[j], plane_normal, origin);
+
+				int8_t degree[PTM_MAX_NBRS];
+				int8_t labelling[PTM_MAX_POINTS] = {0};
+				int8_t code[2 * PTM_MAX_EDGES];
+				uint64_t hash = 0;
+				graph_degree(s->num_facets, facets, s->num_nbrs, degree);
+				int ret = canonical_form_coloured(s->num_facets, facets, s->num_nbrs, degree, c, labelling, code, &hash);
+				if (	   ret != PTM_NO_ERROR || hash != g->hash
+					|| memcmp(facets, g->facets, sizeof(facets)) != 0
+					|| memcmp(labelling, g->canonical_labelling, s->num_nbrs + 1) != 0
+					|| g->id != raw[s->type][i].id
+					|| g->automorphism_index != raw[s->type][i].automorphism_index
+					|| g->num_automorphisms != raw[s->type][i].num_automorphisms)
+					CLEANUP("failed on generated graph data", -1);
+
+				graphentry_t entry = {hash, s, g};
+				rebuilt[num_rebuilt++] = entry;
+			}
+		}
+
+		std::stable_sort(rebuilt, rebuilt + num_rebuilt, &graphentry_compare);
+		if (num_rebuilt != PTM_NUM_GRAPHS)
+			CLEANUP("failed on generated graph index", -1);
+
+		for (int i=0;i<num_rebuilt;i++)
+			if (	   rebuilt[i].hash != graph_entries[i].hash
+				|| rebuilt[i].ref != graph_entries[i].ref
+				|| rebuilt[i].graph != graph_entries[i].graph)
+				CLEANUP("failed on generated graph index", -1);
+
+		num_tests++;
+	}
+
+	//Voronoi ordering of a BCC environment: the hexagonal faces come first, then the square
+	//faces, then the neighbours without a face
+	{
+		const int num = PTM_MAX_INPUT_POINTS - 1;
+		double points[num][3];
+		int shell[num];
+		int n = 0;
+		for (int i=0;i<4;i++)
+		{
+			double p[3] = {i & 1 ? 2. : -2., i & 2 ? 2. : -2., 0};
+			memcpy(points[n], p, 3 * sizeof(double));
+			shell[n++] = 2;
+		}
+
+		for (int i=0;i<6;i++)
+		{
+			double p[3] = {0, 0, 0};
+			p[i / 2] = i & 1 ? 2 : -2;
+			memcpy(points[n], p, 3 * sizeof(double));
+			shell[n++] = 1;
+		}
+
+		for (int i=0;i<8;i++)
+		{
+			double p[3] = {i & 1 ? 1. : -1., i & 2 ? 1. : -1., i & 4 ? 1. : -1.};
+			memcpy(points[n], p, 3 * sizeof(double));
+			shell[n++] = 0;
+		}
+
+		uint64_t code = 0;
+		ret = ptm_preorder_neighbours(local_handle, num, points, &code);
+		if (ret != PTM_NO_ERROR)
+			CLEANUP("Voronoi ordering failed", ret);
+
+		int permutation[num];
+		ptm_index_to_permutation(num, code, permutation);
+		for (int i=0;i<num;i++)
+			if (shell[permutation[i]] != (i < 8 ? 0 : (i < 14 ? 1 : 2)))
+				CLEANUP("failed on Voronoi ordering", -1);
+
+		num_tests++;
+	}
+
+	//batch indexing of periodic crystals
+	{
+		const double fcc_basis[4][3] = {{0, 0, 0}, {0, 0.5, 0.5}, {0.5, 0, 0.5}, {0.5, 0.5, 0}};
+		const double bcc_basis[2][3] = {{0, 0, 0}, {0.5, 0.5, 0.5}};
+		const double dcub_basis[8][3] = {	{0, 0, 0}, {0, 0.5, 0.5}, {0.5, 0, 0.5}, {0.5, 0.5, 0},
+							{0.25, 0.25, 0.25}, {0.25, 0.75, 0.75}, {0.75, 0.25, 0.75}, {0.75, 0.75, 0.25}};
+		const double (*bases[3])[3] = {fcc_basis, bcc_basis, dcub_basis};
+		int num_basis[3] = {4, 2, 8};
+		int32_t checks[3] = {PTM_CHECK_DEFAULT, PTM_CHECK_DEFAULT, PTM_CHECK_DCUB | PTM_CHECK_DHEX};
+		int32_t types[3] = {PTM_MATCH_FCC, PTM_MATCH_BCC, PTM_MATCH_DCUB};
+
+		const int n = 4, max_nbrs = 18;
+		const double a = 3.0;
+		double (*positions)[3] = new double[8 * n * n * n][3];
+		int32_t* nbrs = new int32_t[8 * n * n * n * max_nbrs];
+		int32_t* btypes = new int32_t[8 * n * n * n];
+		double* brmsd = new double[8 * n * n * n];
+		double* blattice = new double[8 * n * n * n];
+		int8_t (*bindices)[PTM_MAX_INPUT_POINTS] = new int8_t[8 * n * n * n][PTM_MAX_INPUT_POINTS];
+
+		for (int it=0;it<3;it++)
+		{
+			ptm_system_t system;
+			double cell[9];
+			int num_atoms = make_lattice(num_basis[it], bases[it], n, a, positions, cell);
+			build_neighbour_table(num_atoms, positions, n * a, max_nbrs, nbrs);
+
+			system.num_atoms = num_atoms;
+			system.positions = positions;
+			system.numbers = NULL;
+			system.cell = cell;
+			system.pbc[0] = system.pbc[1] = system.pbc[2] = true;
+			system.max_nbrs = max_nbrs;
+			system.nbrs = nbrs;
+
+			ptm_output_t output;
+			memset(&output, 0, sizeof(ptm_output_t));
+			output.mask = PTM_OUTPUT_RMSD | PTM_OUTPUT_LATTICE_CONSTANT | PTM_OUTPUT_INDICES;
+			output.type = btypes;
+			output.rmsd = brmsd;
+			output.lattice_constant = blattice;
+			output.output_indices = bindices;
+
+			ret = ptm_index_many(local_handle, &system, checks[it], false, INFINITY, NULL, &output);
+			if (ret != PTM_NO_ERROR)
+				CLEANUP("batch indexing failed", ret);
+
+			for (int i=0;i<num_atoms;i++)
+			{
+				if (btypes[i] != types[it])
+					CLEANUP("failed on batch type", -1);
+
+				if (brmsd[i] > tolerance)
+					CLEANUP("failed on batch rmsd", -1);
+
+				if (fabs(blattice[i] - a) > tolerance)
+					CLEANUP("failed on batch lattice constant", -1);
+
+				if (bindices[i][0] != 0)
+					CLEANUP("failed on batch output indices", -1);
+			}
+
+			ret = ptm_index_many(local_handle, &system, checks[it] | PTM_SINGLE_PRECISION, false, INFINITY, NULL, &output);
+			if (ret != PTM_NO_ERROR)
+				CLEANUP("batch indexing failed", ret);
+
+			for (int i=0;i<num_atoms;i++)
+				if (btypes[i] != types[it] || brmsd[i] > tolerance)
+					CLEANUP("failed on single precision batch indexing", -1);
+
+			num_tests++;
+
+			//threaded indexing of a disordered system must agree with serial indexing
+			srand(it);
+			for (int i=0;i<num_atoms;i++)
+				for (int j=0;j<3;j++)
+					positions[i][j] += 0.3 * ((double)rand() / RAND_MAX - 0.5);
+			build_neighbour_table(num_atoms, positions, n * a, max_nbrs, nbrs);
+
+			ret = ptm_index_many(local_handle, &system, PTM_CHECK_ALL, false, INFINITY, NULL, &output);
+			if (ret != PTM_NO_ERROR)
+				CLEANUP("batch indexing failed", ret);
+
+			int32_t* ttypes = new int32_t[num_atoms];
+			double* trmsd = new double[num_atoms];
+			ptm_output_t toutput;
+			memset(&toutput, 0, sizeof(ptm_output_t));
+			toutput.mask = PTM_OUTPUT_RMSD;
+			toutput.type = ttypes;
+			toutput.rmsd = trmsd;
+
+			ret = ptm_index_many_threaded(&system, PTM_CHECK_ALL, false, INFINITY, 4, NULL, &toutput, NULL);
+			bool equal = true;
+			for (int i=0;i<num_atoms;i++)
+				if (ttypes[i] != btypes[i] || (btypes[i] != PTM_MATCH_NONE && trmsd[i] != brmsd[i]))
+					equal = false;
+
+			//an RMSD cutoff only rejects the atoms whose best match is above it
+			const double max_rmsd = 0.1;
+			bool cut = true;
+			if (ret == PTM_NO_ERROR)
+				ret = ptm_index_many_threaded(&system, PTM_CHECK_ALL, false, max_rmsd, 4, NULL, &toutput, NULL);
+			for (int i=0;i<num_atoms;i++)
+			{
+				bool accepted = btypes[i] != PTM_MATCH_NONE && brmsd[i] < max_rmsd;
+				if (ttypes[i] != (accepted ? btypes[i] : PTM_MATCH_NONE) || (accepted && fabs(trmsd[i] - brmsd[i]) > tolerance))
+					cut = false;
+			}
+
+			//single precision screening must assign the same types as double precision
+			bool same = true;
+			if (ret == PTM_NO_ERROR)
+				ret = ptm_index_many(local_handle, &system, PTM_CHECK_ALL | PTM_SINGLE_PRECISION, false, INFINITY, NULL, &toutput);
+			for (int i=0;i<num_atoms;i++)
+				if (ttypes[i] != btypes[i] || (btypes[i] != PTM_MATCH_NONE && fabs(trmsd[i] - brmsd[i]) > tolerance))
+					same = false;
+
+			delete[] ttypes;
+			delete[] trmsd;
+			if (ret != PTM_NO_ERROR)
+				CLEANUP("threaded batch indexing failed", ret);
+			if (!equal)
+				CLEANUP("failed on threaded batch indexing", -1);
+			if (!cut)
+				CLEANUP("failed on batch indexing with rmsd cutoff", -1);
+			if (!same)
+				CLEANUP("failed on single precision batch indexing", -1);
+
+			num_tests++;
+		}
+
+		delete[] positions;
+		delete[] nbrs;
+		delete[] btypes;
+		delete[] brmsd;
+		delete[] blattice;
+		delete[] bindices;
+	}
+
+	//a warm start from the previous frame gives the same results as matching in full
+	{
+		const double fcc_basis[4][3] = {{0, 0, 0}, {0, 0.5, 0.5}, {0.5, 0, 0.5}, {0.5, 0.5, 0}};
+		const double dcub_basis[8][3] = {	{0, 0, 0}, {0, 0.5, 0.5}, {0.5, 0, 0.5}, {0.5, 0.5, 0},
+							{0.25, 0.25, 0.25}, {0.25, 0.75, 0.75}, {0.75, 0.25, 0.75}, {0.75, 0.75, 0.25}};
+		const double (*bases[2])[3] = {fcc_basis, dcub_basis};
+		int num_basis[2] = {4, 8};
+		int32_t checks[2] = {PTM_CHECK_DEFAULT, PTM_CHECK_ALL};
+
+		const int n = 3;
+		const double a = 3.0;
+		double (*positions)[3] = new double[8 * n * n * n][3];
+		int32_t* types = new int32_t[8 * n * n * n];
+		int32_t* wtypes = new int32_t[8 * n * n * n];
+		double* rmsd = new double[8 * n * n * n];
+		double* wrmsd = new double[8 * n * n * n];
+
+		ptm_warm_start_t warm_start = ptm_initialize_warm_start(0.1);
+		bool same = true, reused = true;
+		for (int it=0;it<2;it++)
+		{
+			double cell[9];
+			int num_atoms = make_lattice(num_basis[it], bases[it], n, a, positions, cell);
+			ptm_system_t system = {(size_t)num_atoms, positions, NULL, cell, {true, true, true}, 0, NULL};
+
+			ptm_output_t output, woutput;
+			memset(&output, 0, sizeof(ptm_output_t));
+			output.mask = PTM_OUTPUT_RMSD;
+			woutput = output;
+			output.type = types;
+			output.rmsd = rmsd;
+			woutput.type = wtypes;
+			woutput.rmsd = wrmsd;
+
+			srand(it);
+			for (int frame=0;frame<3;frame++)
+			{
+				for (int i=0;i<num_atoms;i++)
+					for (int j=0;j<3;j++)
+						positions[i][j] += 0.02 * ((double)rand() / RAND_MAX - 0.5);
+
+				ptm_stats_t thread_stats[2];
+				ret = ptm_index_many(local_handle, &system, checks[it], false, INFINITY, NULL, &output);
+				if (ret == PTM_NO_ERROR)
+					ret = ptm_index_many_threaded(&system, checks[it], false, INFINITY, 2, warm_start, &woutput, thread_stats);
+				if (ret != PTM_NO_ERROR)
+					break;
+
+				for (int i=0;i<num_atoms;i++)
+					if (wtypes[i] != types[i] || fabs(wrmsd[i] - rmsd[i]) > tolerance)
+						same = false;
+
+				//the first frame of each lattice has nothing to reuse; the later frames must reuse matches
+#ifdef PTM_ENABLE_STATS
+				if (frame > 0 && thread_stats[0].num_reused + thread_stats[1].num_reused == 0)
+					reused = false;
+#else
+				(void)thread_stats;
+#endif
+			}
+		}
+
+		ptm_uninitialize_warm_start(warm_start);
+		delete[] positions;
+		delete[] types;
+		delete[] wtypes;
+		delete[] rmsd;
+		delete[] wrmsd;
+		if (ret != PTM_NO_ERROR)
+			CLEANUP("warm start indexing failed", ret);
+		if (!same)
+			CLEANUP("failed on warm start indexing", -1);
+		if (!reused)
+			CLEANUP("failed on warm start reuse", -1);
+
+		num_tests++;
+	}
+
+	//cell-list neighbour search agrees with a brute force search
+	{
+		const double fcc_basis[4][3] = {{0, 0, 0}, {0, 0.5, 0.5}, {0.5, 0, 0.5}, {0.5, 0.5, 0}};
+		const int n = 4, max_nbrs = 18;
+		const double a = 3.0;
+		const int num_atoms = 4 * n * n * n;
+		double (*positions)[3] = new double[num_atoms][3];
+		int32_t* nbrs = new int32_t[num_atoms * max_nbrs];
+		double* dist = new double[num_atoms];
+		int32_t* btypes = new int32_t[num_atoms];
+
+		for (int it=0;it<4;it++)
+		{
+			double cell[9];
+			make_lattice(4, fcc_basis, n, a, positions, cell);
+
+			srand(it);
+			for (int i=0;i<num_atoms;i++)
+				for (int j=0;j<3;j++)
+					positions[i][j] += 0.6 * ((double)rand() / RAND_MAX - 0.5);
+
+			ptm_system_t system;
+			memset(&system, 0, sizeof(ptm_system_t));
+			system.num_atoms = num_atoms;
+			system.positions = positions;
+			system.cell = cell;
+			system.pbc[0] = system.pbc[1] = system.pbc[2] = true;
+			if (it == 1)
+			{
+				//triclinic cell
+				cell[3] = 0.3 * n * a;
+				cell[7] = -0.2 * n * a;
+				for (int i=0;i<num_atoms;i++)
+				{
+					positions[i][0] += 0.3 * positions[i][1];
+					positions[i][1] -= 0.2 * positions[i][2];
+				}
+			}
+			else if (it == 2)
+			{
+				//non-periodic
+				system.cell = NULL;
+				system.pbc[0] = system.pbc[1] = system.pbc[2] = false;
+			}
+
+			//the brute force search only tries neighbouring images, so it is given a cell with small tilts
+			double reference_cell[9];
+			memcpy(reference_cell, cell, 9 * sizeof(double));
+			if (it == 3)
+			{
+				//strongly skewed cell of the same lattice, where rounding fractional coordinates
+				//can give a farther image than the nearest one
+				double skewed[9] = {1, 0, 0, 2, 1, 0, 1, 2, 1};
+				for (int j=0;j<9;j++)
+					cell[j] = n * a * skewed[j];
+			}
+
+			ret = ptm_build_neighbour_table(&system, max_nbrs, 4, nbrs);
+			if (ret != PTM_NO_ERROR)
+				CLEANUP("neighbour search failed", ret);
+
+			for (int i=0;i<num_atoms;i++)
+			{
+				for (int j=0;j<num_atoms;j++)
+					dist[j] = j == i ? INFINITY : image_distance(system.cell == NULL ? NULL : reference_cell, system.pbc, positions[i], positions[j]);
+				std::sort(dist, dist + num_atoms);
+
+				for (int j=0;j<max_nbrs;j++)
+				{
+					int32_t index = nbrs[i * max_nbrs + j];
+					if (index < 0 || index == i)
+						CLEANUP("failed on neighbour search index", -1);
+
+					double d = image_distance(system.cell == NULL ? NULL : reference_cell, system.pbc, positions[i], positions[index]);
+					if (fabs(d - dist[j]) > tolerance)
+						CLEANUP("failed on neighbour search distance", -1);
+				}
+			}
+
+			num_tests++;
+		}
+
+		//batch indexing without a neighbour table
+		double cell[9];
+		make_lattice(4, fcc_basis, n, a, positions, cell);
+
+		ptm_system_t system;
+		memset(&system, 0, sizeof(ptm_system_t));
+		system.num_atoms = num_atoms;
+		system.positions = positions;
+		system.cell = cell;
+		system.pbc[0] = system.pbc[1] = system.pbc[2] = true;
+
+		ptm_output_t output;
+		memset(&output, 0, sizeof(ptm_output_t));
+		output.mask = PTM_OUTPUT_RMSD;
+		output.type = btypes;
+		output.rmsd = dist;
+
+		ret = ptm_index_many_threaded(&system, PTM_CHECK_ALL, false, INFINITY, 4, NULL, &output, NULL);
+		if (ret != PTM_NO_ERROR)
+			CLEANUP("batch indexing failed", ret);
+
+		for (int i=0;i<num_atoms;i++)
+			if (btypes[i] != PTM_MATCH_FCC || dist[i] > tolerance)
+				CLEANUP("failed on batch indexing without neighbour table", -1);
+
+		num_tests++;
+
+		//columns missing from the output mask are not written.  Every column has its own flag: RMSD
+		//does not write the scale or lattice constant, and QUAT does not write the template index.
+		double (*bq)[4] = new double[num_atoms][4];
+		double* bscale = new double[num_atoms];
+		double* blattice = new double[num_atoms];
+		int* btemplate = new int[num_atoms];
+		for (int i=0;i<num_atoms;i++)
+		{
+			bq[i][0] = bq[i][1] = bq[i][2] = bq[i][3] = 7;
+			bscale[i] = blattice[i] = 7;
+			btemplate[i] = 7;
+		}
+
+		output.q = bq;
+		output.scale = bscale;
+		output.lattice_constant = blattice;
+		output.best_template_index = btemplate;
+		ret = ptm_index_many(local_handle, &system, PTM_CHECK_ALL, false, INFINITY, NULL, &output);
+		bool untouched = true;
+		for (int i=0;i<num_atoms;i++)
+			if (bq[i][0] != 7 || bq[i][3] != 7 || bscale[i] != 7 || blattice[i] != 7 || btemplate[i] != 7)
+				untouched = false;
+
+		output.mask |= PTM_OUTPUT_QUAT;
+		if (ret == PTM_NO_ERROR)
+			ret = ptm_index_many(local_handle, &system, PTM_CHECK_ALL, false, INFINITY, NULL, &output);
+
+		bool written = true;
+		for (int i=0;i<num_atoms;i++)
+		{
+			if (fabs(bq[i][0] * bq[i][0] + bq[i][1] * bq[i][1] + bq[i][2] * bq[i][2] + bq[i][3] * bq[i][3] - 1) > tolerance)
+				written = false;
+			if (bscale[i] != 7 || blattice[i] != 7 || btemplate[i] != 7)
+				untouched = false;
+		}
+
+		output.mask |= PTM_OUTPUT_SCALE | PTM_OUTPUT_LATTICE_CONSTANT | PTM_OUTPUT_TEMPLATE_INDEX;
+		if (ret == PTM_NO_ERROR)
+			ret = ptm_index_many(local_handle, &system, PTM_CHECK_ALL, false, INFINITY, NULL, &output);
+
+		for (int i=0;i<num_atoms;i++)
+			if (bscale[i] == 7 || fabs(blattice[i] - a) > tolerance || btemplate[i] != 0)
+				written = false;
+
+		output.q = NULL;
+		output.scale = NULL;
+		output.lattice_constant = NULL;
+		output.best_template_index = NULL;
+		delete[] bq;
+		delete[] bscale;
+		delete[] blattice;
+		delete[] btemplate;
+		if (ret != PTM_NO_ERROR)
+			CLEANUP("batch indexing failed", ret);
+		if (!untouched || !written)
+			CLEANUP("failed on batch output mask", -1);
+
+		num_tests++;
+
+		//atoms without neighbours are unmatched, and their rows are written with an infinite RMSD and zeros
+		{
+			int32_t empty_nbrs[4] = {-1, -1, -1, -1};
+			double uq[4][4], uscale[4];
+			ptm_system_t usystem;
+			memset(&usystem, 0, sizeof(ptm_system_t));
+			usystem.num_atoms = 4;
+			usystem.positions = positions;
+			usystem.max_nbrs = 1;
+			usystem.nbrs = empty_nbrs;
+
+			ptm_output_t uoutput;
+			memset(&uoutput, 0, sizeof(ptm_output_t));
+			uoutput.mask = PTM_OUTPUT_RMSD | PTM_OUTPUT_QUAT | PTM_OUTPUT_SCALE;
+			uoutput.type = btypes;
+			uoutput.rmsd = dist;
+			uoutput.q = uq;
+			uoutput.scale = uscale;
+			for (int i=0;i<4;i++)
+			{
+				btypes[i] = 7;
+				dist[i] = uscale[i] = 7;
+				uq[i][0] = uq[i][1] = uq[i][2] = uq[i][3] = 7;
+			}
+
+			ret = ptm_index_many(local_handle, &usystem, PTM_CHECK_ALL, false, INFINITY, NULL, &uoutput);
+			if (ret != PTM_NO_ERROR)
+				CLEANUP("batch indexing failed", ret);
+
+			for (int i=0;i<4;i++)
+				if (	   btypes[i] != PTM_MATCH_NONE || dist[i] != INFINITY || uscale[i] != 0
+					|| uq[i][0] != 0 || uq[i][1] != 0 || uq[i][2] != 0 || uq[i][3] != 0)
+					CLEANUP("failed on unmatched batch rows", -1);
+
+			num_tests++;
+		}
+
+		//statistics are only gathered when compiled in
+		output.mask = PTM_OUTPUT_RMSD;
+		ptm_stats_t stats, thread_stats[4];
+		ptm_reset_stats(local_handle);
+		ret = ptm_index_many(local_handle, &system, PTM_CHECK_ALL, false, INFINITY, NULL, &output);
+		if (ret == PTM_NO_ERROR)
+			ret = ptm_index_many_threaded(&system, PTM_CHECK_ALL, false, INFINITY, 4, NULL, &output, thread_stats);
+		if (ret != PTM_NO_ERROR)
+			CLEANUP("batch indexing failed", ret);
+
+		int stats_ret = ptm_get_stats(local_handle, &stats);
+		uint64_t threaded_atoms = 0;
+		for (int i=0;i<4;i++)
+			threaded_atoms += thread_stats[i].num_atoms;
+#ifdef PTM_ENABLE_STATS
+		if (	   stats_ret != PTM_NO_ERROR
+			|| stats.num_atoms != (uint64_t)num_atoms || stats.num_matched != (uint64_t)num_atoms
+			|| stats.calls[PTM_STAGE_OUTPUT] != (uint64_t)num_atoms
+			|| stats.calls[PTM_STAGE_CONVEX_HULL] < (uint64_t)num_atoms
+			|| stats.rejected[PTM_REJECT_FACETS] + stats.rejected[PTM_REJECT_DEGREE] == 0
+			|| threaded_atoms != (uint64_t)num_atoms)
+			CLEANUP("failed on statistics", -1);
+#else
+		if (stats_ret != -1 || stats.num_atoms != 0 || threaded_atoms != 0)
+			CLEANUP("failed on statistics", -1);
+#endif
+		num_tests++;
+
+		//Voronoi ordering of a whole system puts the twelve faces of the FCC cell first, and the
+		//ordered table can be consumed by the batch indexing
+		const int num_ordered = 14;
+		int32_t* ordered = new int32_t[num_atoms * num_ordered];
+		ret = ptm_preorder_neighbour_table(&system, num_ordered, 4, ordered);
+
+		bool ordered_ok = true;
+		for (int i=0;i<num_atoms && ret == PTM_NO_ERROR;i++)
+			for (int j=0;j<num_ordered;j++)
+			{
+				int32_t index = ordered[i * num_ordered + j];
+				if (index < 0)
+					ordered_ok = false;
+				else if ((j < 12) != (image_distance(system.cell, system.pbc, positions[i], positions[index]) < 0.75 * a * a))
+					ordered_ok = false;
+			}
+
+		ptm_system_t ordered_system = system;
+		ordered_system.max_nbrs = num_ordered;
+		ordered_system.nbrs = ordered;
+		if (ret == PTM_NO_ERROR)
+			ret = ptm_index_many(local_handle, &ordered_system, PTM_CHECK_DEFAULT, false, INFINITY, NULL, &output);
+
+		for (int i=0;i<num_atoms && ret == PTM_NO_ERROR;i++)
+			if (btypes[i] != PTM_MATCH_FCC || dist[i] > tolerance)
+				ordered_ok = false;
+
+		delete[] ordered;
+		if (ret != PTM_NO_ERROR)
+			CLEANUP("Voronoi ordering of system failed", ret);
+		if (!ordered_ok)
+			CLEANUP("failed on Voronoi ordering of system", -1);
+
+		num_tests++;
+
+		delete[] positions;
+		delete[] nbrs;
+		delete[] dist;
+		delete[] btypes;
+	}
+
 cleanup:
 	printf("num tests completed: %d\n", num_tests);
 	ptm_uninitialize_local(local_handle);